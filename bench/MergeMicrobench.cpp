@@ -0,0 +1,214 @@
+// MergeMicrobench.cpp
+// Google Benchmark cases for quick iteration on merge kernels
+//
+// Every strategy x size x distribution x K combination is its own case, e.g.
+//   merge_microbench --benchmark_filter='CacheBlocked/size:10000000/dist:1'
+// Results report bytes/s and items/s of merged output.
+
+#include "../include/IMergeStrategy.h"
+#include "../include/SequentialMergeStrategy.h"
+#include "../include/ParallelMergeStrategy.h"
+#include "../include/CacheBlockedMergeStrategy.h"
+#include "../include/SharedMemoryMergeStrategy.h"
+#include "../include/DataGenerator.h"
+#include "../include/SystemInfo.h"
+#include "../include/MemoryTracker.h"
+#include <benchmark/benchmark.h>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+	// Shape of the two input vectors
+	enum class Distribution {
+		Uniform = 0,     // random values in [1, 1'000'000]
+		Duplicates = 1,  // random values in [1, 16], long runs of equal keys
+		Disjoint = 2,    // every element of vec1 is below every element of vec2
+		Interleaved = 3  // vec1 = even numbers, vec2 = odd numbers
+	};
+
+	constexpr int UNIFORM_MAX = 1'000'000;
+	constexpr int DUPLICATES_MAX = 16;
+	constexpr int DISJOINT_SPLIT = 500'000;
+
+	const std::vector<int64_t> SIZES = { 100'000, 1'000'000, 10'000'000 };
+	const std::vector<int64_t> DISTRIBUTIONS = {
+		static_cast<int64_t>(Distribution::Uniform),
+		static_cast<int64_t>(Distribution::Duplicates),
+		static_cast<int64_t>(Distribution::Disjoint),
+		static_cast<int64_t>(Distribution::Interleaved)
+	};
+
+	using Inputs = std::pair<std::vector<int>, std::vector<int>>;
+
+	Inputs generateInputs(size_t size, Distribution distribution) {
+		size_t halfSize = size / 2;
+		switch (distribution) {
+		case Distribution::Duplicates: {
+			DataGenerator generator(1, DUPLICATES_MAX);
+			return { generator.generateSortedData(halfSize), generator.generateSortedData(halfSize) };
+		}
+		case Distribution::Disjoint: {
+			DataGenerator low(1, DISJOINT_SPLIT);
+			DataGenerator high(DISJOINT_SPLIT + 1, UNIFORM_MAX);
+			return { low.generateSortedData(halfSize), high.generateSortedData(halfSize) };
+		}
+		case Distribution::Interleaved: {
+			Inputs inputs;
+			inputs.first.reserve(halfSize);
+			inputs.second.reserve(halfSize);
+			for (size_t i = 0; i < halfSize; ++i) {
+				inputs.first.push_back(static_cast<int>(2 * i));
+				inputs.second.push_back(static_cast<int>(2 * i + 1));
+			}
+			return inputs;
+		}
+		case Distribution::Uniform:
+		default: {
+			DataGenerator generator(1, UNIFORM_MAX);
+			return { generator.generateSortedData(halfSize), generator.generateSortedData(halfSize) };
+		}
+		}
+	}
+
+	// Inputs are generated once per (size, distribution) and shared by all cases
+	const Inputs& getInputs(size_t size, Distribution distribution) {
+		static std::map<std::pair<size_t, Distribution>, Inputs> cache;
+		auto key = std::make_pair(size, distribution);
+		auto it = cache.find(key);
+		if (it == cache.end()) {
+			it = cache.emplace(key, generateInputs(size, distribution)).first;
+		}
+		return it->second;
+	}
+
+	using StrategyFactory = std::function<std::unique_ptr<IMergeStrategy>(int)>;
+
+	// One extra untimed run for memory counters (ENABLE_MEMORY_TRACKING builds)
+	template<typename MergeOnce>
+	void reportMemoryCounters(benchmark::State& state, MergeOnce&& mergeOnce) {
+		if (!MemoryTracker::isEnabled()) {
+			return;
+		}
+		MemoryTracker::beginMeasurement();
+		mergeOnce();
+		MemoryStats memory = MemoryTracker::endMeasurement();
+		state.counters["allocs"] = memory.allocations;
+		state.counters["alloc_bytes"] = benchmark::Counter(memory.bytesAllocated, benchmark::Counter::kDefaults,
+														   benchmark::Counter::kIs1024);
+		state.counters["peak_bytes"] = benchmark::Counter(memory.peakLiveBytes, benchmark::Counter::kDefaults,
+														  benchmark::Counter::kIs1024);
+		state.counters["max_rss_growth"] = benchmark::Counter(memory.maxRssGrowthBytes, benchmark::Counter::kDefaults,
+															  benchmark::Counter::kIs1024);
+		if (MemoryTracker::isMeasured(memory.minorFaults)) {
+			state.counters["minor_faults"] = memory.minorFaults;
+		}
+	}
+
+	void setProcessed(benchmark::State& state, const Inputs& inputs) {
+		int64_t outputSize = static_cast<int64_t>(inputs.first.size() + inputs.second.size());
+		state.SetItemsProcessed(state.iterations() * outputSize);
+		state.SetBytesProcessed(state.iterations() * outputSize * static_cast<int64_t>(sizeof(int)));
+	}
+
+	// Args: {size, distribution, K}
+	void runMergeCase(benchmark::State& state, const StrategyFactory& factory) {
+		size_t size = static_cast<size_t>(state.range(0));
+		auto distribution = static_cast<Distribution>(state.range(1));
+		int K = static_cast<int>(state.range(2));
+
+		const Inputs& inputs = getInputs(size, distribution);
+		auto strategy = factory(K);
+
+		auto mergeOnce = [&]() {
+			auto result = strategy->merge(inputs.first, inputs.second);
+			// Keep the compiler from dropping the merge as dead code
+			benchmark::DoNotOptimize(result.data());
+			benchmark::ClobberMemory();
+		};
+		for (auto _ : state) {
+			mergeOnce();
+		}
+
+		reportMemoryCounters(state, mergeOnce);
+		setProcessed(state, inputs);
+	}
+
+	// Cache-blocked kernel writing into fresh, uninitialized storage.
+	// The allocation is timed; there is no serial zero-fill to pay for.
+	// Args: {size, distribution, K}
+	void runMergeIntoCase(benchmark::State& state) {
+		size_t size = static_cast<size_t>(state.range(0));
+		auto distribution = static_cast<Distribution>(state.range(1));
+		int K = static_cast<int>(state.range(2));
+
+		const Inputs& inputs = getInputs(size, distribution);
+		CacheBlockedMergeStrategy strategy(K);
+		size_t outputSize = inputs.first.size() + inputs.second.size();
+
+		auto mergeOnce = [&]() {
+			std::unique_ptr<int[]> output(new int[outputSize]);
+			strategy.mergeInto(inputs.first.data(), inputs.first.size(),
+							   inputs.second.data(), inputs.second.size(), output.get());
+			benchmark::DoNotOptimize(output.get());
+			benchmark::ClobberMemory();
+		};
+		for (auto _ : state) {
+			mergeOnce();
+		}
+
+		reportMemoryCounters(state, mergeOnce);
+		setProcessed(state, inputs);
+	}
+
+	// K values: 1, 2, 4 ... up to the hardware thread count, plus the thread count itself
+	std::vector<int64_t> generateKValues() {
+		int64_t cpuThreads = SystemInfo::getHardwareThreads();
+		std::vector<int64_t> kValues;
+		for (int64_t K = 1; K < cpuThreads; K *= 2) {
+			kValues.push_back(K);
+		}
+		kValues.push_back(cpuThreads);
+		return kValues;
+	}
+
+	void applyArgs(benchmark::internal::Benchmark* bench, const std::vector<int64_t>& kValues) {
+		bench->ArgsProduct({ SIZES, DISTRIBUTIONS, kValues })
+			->ArgNames({ "size", "dist", "K" })
+			->UseRealTime()
+			->Unit(benchmark::kMillisecond);
+	}
+
+	void registerStrategy(const std::string& name, const StrategyFactory& factory,
+						  const std::vector<int64_t>& kValues) {
+		applyArgs(benchmark::RegisterBenchmark(name.c_str(), [factory](benchmark::State& state) {
+				runMergeCase(state, factory);
+			}), kValues);
+	}
+}
+
+int main(int argc, char** argv) {
+    std::vector<int64_t> kValues = generateKValues();
+    
+    // Sequential merge has no K, it only runs with K=1
+    registerStrategy("Sequential", [](int) { return std::make_unique<SequentialMergeStrategy>(); }, { 1 });
+    registerStrategy("Parallel", [](int K) { return std::make_unique<ParallelMergeStrategy>(K); }, kValues);
+    registerStrategy("CacheBlocked", [](int K) { return std::make_unique<CacheBlockedMergeStrategy>(K); }, kValues);
+    // Same kernel without std::vector zero-filling the output first
+    applyArgs(benchmark::RegisterBenchmark("CacheBlockedInto", runMergeIntoCase), kValues);
+    // Worker processes are forked when the strategy is created, before the timed loop
+    if (SharedMemoryMergeStrategy::isSupported()) {
+        registerStrategy("SharedMemory", [](int K) { return std::make_unique<SharedMemoryMergeStrategy>(K); }, kValues);
+    }
+    
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -4,6 +4,7 @@
 #ifndef BENCHMARK_RESULT_H
 #define BENCHMARK_RESULT_H
 
+#include "MemoryTracker.h"
 #include <string>
 
 // Simple struct to hold benchmark results
@@ -12,6 +13,8 @@ struct BenchmarkResult {
     double averageTime;
     double speedup;
     int threadCount;
+    // Average memory cost per run (all zeros unless memory tracking is enabled)
+    MemoryStats memory;
     
     BenchmarkResult(const std::string& name, double time, double sp, int threads = 1);
 };
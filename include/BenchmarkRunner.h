@@ -7,6 +7,8 @@
 #include "DataGenerator.h"
 #include "IMergeStrategy.h"
 #include "BenchmarkResult.h"
+#include <functional>
+#include <string>
 
 // Handles running benchmarks and measuring execution time
 class BenchmarkRunner {
@@ -21,6 +23,17 @@ public:
     // Run a benchmark and get average time
     BenchmarkResult runBenchmark(IMergeStrategy& strategy, double baselineTime = 0.0);
     
+    // Same as above, but on data prepared by the caller
+    // (useful for huge sizes where generating data again is slow)
+    BenchmarkResult runBenchmark(IMergeStrategy& strategy, const std::vector<int>& vec1,
+                                 const std::vector<int>& vec2, double baselineTime = 0.0);
+    
+    // Time an arbitrary merge call, for entry points that don't go through
+    // IMergeStrategy::merge (e.g. merging into caller-provided storage).
+    // Everything done inside mergeOnce, allocation included, is timed.
+    BenchmarkResult runBenchmark(const std::string& name, int threadCount,
+                                 const std::function<void()>& mergeOnce, double baselineTime = 0.0);
+    
     // Run benchmark with detailed output
     BenchmarkResult runDetailedBenchmark(IMergeStrategy& strategy);
 };
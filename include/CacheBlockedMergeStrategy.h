@@ -0,0 +1,41 @@
+// CacheBlockedMergeStrategy.h
+// Cache-aware parallel merge for outputs larger than the CPU caches
+
+#ifndef CACHE_BLOCKED_MERGE_STRATEGY_H
+#define CACHE_BLOCKED_MERGE_STRATEGY_H
+
+#include "ParallelMergeStrategy.h"
+
+// Same partitioning as ParallelMergeStrategy, but with a different kernel:
+// 1. Every thread writes straight into the final output (no concatenation step)
+// 2. Each thread merges in L2-sized tiles and prefetches ahead on both inputs
+// 3. If the output is bigger than the last level cache, tiles are merged into
+//    a small staging buffer and copied out with non-temporal (streaming) stores,
+//    so the output does not evict the inputs and skips read-for-ownership
+class CacheBlockedMergeStrategy : public ParallelMergeStrategy {
+private:
+    size_t tileElements_;
+    size_t streamingThresholdBytes_;
+    
+public:
+    // Tile size and streaming threshold are detected from the CPU cache sizes
+    explicit CacheBlockedMergeStrategy(int K);
+    
+    // Note: the std::vector result is zero-filled by the calling thread
+    // before any worker starts; use mergeInto to avoid that
+    std::vector<int> merge(const std::vector<int>& vec1, 
+                          const std::vector<int>& vec2) override;
+    
+    // Merge into caller-provided storage of n1 + n2 ints. The storage may be
+    // uninitialized (e.g. new int[n]), so each worker is the first to touch
+    // its own slice of the output and no serial fill happens.
+    void mergeInto(const int* input1, size_t n1, const int* input2, size_t n2,
+                   int* output) const;
+    
+    std::string getName() const override;
+    
+    // True if an output of this many elements will use streaming stores
+    bool usesStreamingStores(size_t outputSize) const;
+};
+
+#endif // CACHE_BLOCKED_MERGE_STRATEGY_H
@@ -6,6 +6,11 @@
 
 #include "DataGenerator.h"
 #include "BenchmarkResult.h"
+#include "IMergeStrategy.h"
+#include "ScalabilityModel.h"
+#include <functional>
+#include <memory>
+#include <string>
 #include <vector>
 #include <unordered_map>
 
@@ -26,6 +31,20 @@ private:
     // Analyze results and find the best K value
     void analyzeResults(const std::vector<BenchmarkResult>& results, unsigned int cpuThreads);
     
+    // Creates a strategy for a given thread count
+    using StrategyFactory = std::function<std::unique_ptr<IMergeStrategy>(int)>;
+    
+    // Thread counts for scaling sweeps: 1 up to 2x the CPU threads
+    std::vector<int> generateScalingThreadCounts(unsigned int cpuThreads);
+    
+    // Run one sweep. Weak scaling grows the size with the thread count
+    // (size = threads * baseSize), strong scaling keeps it at baseSize.
+    void runScalingSweep(const StrategyFactory& factory, const std::vector<int>& threadCounts,
+                         size_t baseSize, bool weakScaling, unsigned int cpuThreads);
+    
+    // Print model parameters and predictions for bigger machines
+    void printScalingAnalysis(const AmdahlFit& amdahl, const UslFit& usl, unsigned int cpuThreads);
+    
 public:
     explicit ExperimentRunner(std::vector<size_t> sizes);
     
@@ -37,6 +56,23 @@ public:
     
     // Experiment 3: Test our custom parallel implementation with different K values
     void runExperiment3_KInvestigation(size_t testSize);
+    
+    // Experiment 4: Compare cache-blocked kernel against plain std::merge on large outputs
+    void runExperiment4_CacheBlockedMerge(const std::vector<size_t>& sizes);
+    
+    // Experiment 5: Strong and weak scaling of every parallel strategy,
+    // fitted with Amdahl's law and the Universal Scalability Law
+    void runExperiment5_ScalingStudy(size_t strongScalingSize, size_t weakScalingSizePerThread);
+    
+    // Experiment 6: Sustained ingest of sorted batches with interleaved reads,
+    // tiered runs with background compaction vs. merging on every append
+    void runExperiment6_IncrementalIndex(size_t batchSize, int batchCount);
+    
+    // Experiment 7: Pages, top-N and median of a merge without merging everything
+    void runExperiment7_PartialMerge(size_t size, size_t pageSize);
+    
+    // Experiment 8: Cost of process isolation - shared-memory worker processes vs. threads
+    void runExperiment8_ProcessIsolation();
 };
 
 #endif // EXPERIMENT_RUNNER_H
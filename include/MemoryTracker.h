@@ -0,0 +1,74 @@
+// MemoryTracker.h
+// Optional allocation counting and process memory sampling
+
+#ifndef MEMORY_TRACKER_H
+#define MEMORY_TRACKER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cmath>
+#include <limits>
+
+// Memory cost of one strategy run (averaged over runs in BenchmarkResult).
+// A value that could not be measured is NaN (see MemoryTracker::isMeasured).
+struct MemoryStats {
+    double allocations = 0.0;     // number of operator new calls
+    double bytesAllocated = 0.0;  // total bytes requested from operator new
+    double peakLiveBytes = 0.0;   // highest live heap above what was live before the run
+    double maxRssGrowthBytes = 0.0; // how much the run raised the process RSS high-water mark
+    double currentRssBytes = 0.0; // process resident set size right after the run
+    double minorFaults = 0.0;     // page faults served without disk I/O during the run
+                                  // (NaN if part of the run happened in other processes)
+};
+
+// Counts heap allocations through replaced global operator new/delete.
+// Only active when built with MERGE_MEMORY_TRACKING (CMake option
+// ENABLE_MEMORY_TRACKING). Otherwise nothing is hooked and
+// isEnabled() returns false, so callers can skip measuring.
+// Aligned (std::align_val_t) allocations are not counted.
+class MemoryTracker {
+public:
+    static constexpr bool isEnabled() {
+#ifdef MERGE_MEMORY_TRACKING
+        return true;
+#else
+        return false;
+#endif
+    }
+    
+    // Start measuring a run: resets the peak to the current live bytes
+    static void beginMeasurement();
+    
+    // Stop measuring and return what happened since beginMeasurement()
+    static MemoryStats endMeasurement();
+    
+    // Record allocations (called from the operator new/delete hooks,
+    // and for memory mapped directly, like shared memory segments)
+    static void recordAllocation(size_t bytes);
+    static void recordDeallocation(size_t bytes);
+    
+    // Part of the measured run happens in other processes (worker processes),
+    // so this process's counters miss their page faults
+    static void recordExternalWork();
+    
+    static constexpr double notMeasured() {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+    
+    static bool isMeasured(double value) {
+        return !std::isnan(value);
+    }
+    
+private:
+    // Process-wide numbers from getrusage and /proc/self/statm
+    // (or the Windows equivalents)
+    struct ProcessSample {
+        uint64_t peakRssBytes;
+        uint64_t currentRssBytes;
+        uint64_t minorFaults;
+    };
+    
+    static ProcessSample sampleProcess();
+};
+
+#endif // MEMORY_TRACKER_H
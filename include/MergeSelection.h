@@ -0,0 +1,42 @@
+// MergeSelection.h
+// Parts of a merge without doing the whole merge (co-rank binary search)
+
+#ifndef MERGE_SELECTION_H
+#define MERGE_SELECTION_H
+
+#include <cstddef>
+#include <vector>
+
+// Answers questions about merge(a, b) without building it:
+// - which element ends up at position k (k-th smallest, median)
+// - what the output looks like in [begin, end) (top-N, pages)
+// Order is the same as std::merge: on ties, elements of the first input
+// (or the earlier run) come first.
+class MergeSelection {
+public:
+    // How many of the first k merged elements come from a (the "co-rank").
+    // O(log(min(|a|, |b|))). Requires k <= |a| + |b|.
+    static size_t coRank(size_t k, const std::vector<int>& a, const std::vector<int>& b);
+    
+    // Element at position k (0-based) of merge(a, b). Requires k < |a| + |b|.
+    static int selectKth(const std::vector<int>& a, const std::vector<int>& b, size_t k);
+    
+    // Output positions [begin, end) of merge(a, b).
+    // Large slices are split into numThreads pieces merged in parallel.
+    static std::vector<int> mergeRange(const std::vector<int>& a, const std::vector<int>& b,
+                                       size_t begin, size_t end, int numThreads = 1);
+    
+    // Element at position k (0-based) of the merge of many sorted runs.
+    // Binary search on the value, O(runs * log(size) * 32).
+    static int selectKth(const std::vector<std::vector<int>>& runs, size_t k);
+    
+    // Output positions [begin, end) of the merge of many sorted runs
+    static std::vector<int> mergeRange(const std::vector<std::vector<int>>& runs,
+                                       size_t begin, size_t end);
+    
+private:
+    // Start position in every run for output position k (multi-run co-rank)
+    static std::vector<size_t> coRanks(const std::vector<std::vector<int>>& runs, size_t k);
+};
+
+#endif // MERGE_SELECTION_H
@@ -4,9 +4,13 @@
 #ifndef OUTPUT_FORMATTER_H
 #define OUTPUT_FORMATTER_H
 
+#include "MemoryTracker.h"
 #include <string>
 
 // Helper class for printing nice-looking output
+// When memory tracking is enabled, every results table gets memory columns
+// (allocations, MB allocated, peak live MB, MB the run added to the RSS
+// high-water mark, current RSS MB, minor faults)
 class OutputFormatter {
 public:
     // Print a big section header
@@ -19,7 +23,33 @@ public:
     static void printTableHeader();
     
     // Print one row of results
-    static void printTableRow(int K, double time, double speedup, double ratio);
+    static void printTableRow(int K, double time, double speedup, double ratio,
+                              const MemoryStats& memory = MemoryStats());
+    
+    // Print table header for comparing named strategies
+    static void printStrategyTableHeader();
+    
+    // Print one strategy row, throughput is in GB/s of output written
+    static void printStrategyTableRow(const std::string& name, double time, 
+                                      double speedup, double throughput,
+                                      const MemoryStats& memory = MemoryStats());
+    
+    // Print table header for a scaling sweep
+    static void printScalingTableHeader();
+    
+    // Print one scaling row with measured and model-predicted capacity,
+    // plus a bar showing parallel efficiency (capacity / threads)
+    static void printScalingTableRow(int threads, size_t size, double time, double capacity,
+                                     double amdahl, double usl,
+                                     const MemoryStats& memory = MemoryStats());
+    
+    // Print table header for the ingest / read latency comparison
+    static void printIngestTableHeader();
+    
+    // Print one ingest row: rate in million elements per second, latencies in microseconds
+    static void printIngestTableRow(const std::string& name, double ingestRate,
+                                    double lookupAvg, double lookupP99,
+                                    double scanAvg, double scanP99);
 };
 
 #endif // OUTPUT_FORMATTER_H
@@ -5,6 +5,16 @@
 #define PARALLEL_MERGE_STRATEGY_H
 
 #include "IMergeStrategy.h"
+#include <cstddef>
+
+// One part of the split: vec1[start1, end1) is merged with vec2[start2, end2).
+// Parts are ordered, so part i's output starts at start1 + start2.
+struct MergePartition {
+    size_t start1;
+    size_t end1;
+    size_t start2;
+    size_t end2;
+};
 
 // Implementation of parallel merge using K threads
 // Algorithm:
@@ -26,6 +36,13 @@ public:
     std::string getName() const override;
     
     int getThreadCount() const;
+    
+    // Steps 1-2 above for one part: vec1 is cut into numParts equal parts,
+    // vec2 is cut with lower_bound on the first element of each part.
+    // Shared by every strategy that splits the same way.
+    static MergePartition computePartition(const int* vec1, size_t n1,
+                                           const int* vec2, size_t n2,
+                                           int part, int numParts);
 };
 
 #endif // PARALLEL_MERGE_STRATEGY_H
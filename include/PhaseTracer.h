@@ -0,0 +1,109 @@
+// PhaseTracer.h
+// Per-thread phase timing, exported as Chrome/Perfetto trace JSON
+
+#ifndef PHASE_TRACER_H
+#define PHASE_TRACER_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Records how long each phase of a merge takes on each thread.
+// Every thread gets its own "lane" the first time it records something:
+// the lane is taken from a free list (or created) under a mutex and kept
+// in a thread_local pointer. After that a lane is only written by its own
+// thread, so recording needs no locks, and merges running at the same
+// time (e.g. a foreground merge during background compaction) don't share
+// lanes. When a thread exits its lane goes back to the free list, so the
+// short-lived merge workers of later merges reuse it.
+//
+// Instrumentation is compiled in only when MERGE_TRACING is defined
+// (CMake option ENABLE_MERGE_TRACING). Otherwise the TRACE_* macros
+// expand to nothing and the build pays no cost.
+class PhaseTracer {
+public:
+    // One finished phase, times are nanoseconds since tracer creation
+    struct Event {
+        const char* name;
+        int64_t startNs;
+        int64_t endNs;
+    };
+    
+    static PhaseTracer& instance();
+    
+    // Current time in nanoseconds since tracer creation
+    int64_t now() const;
+    
+    // Add one event to the calling thread's lane. Name must be a string literal.
+    void record(const char* name, int64_t startNs, int64_t endNs);
+    
+    // Forget all recorded events (lanes stay allocated).
+    // Call only while no traced merge is running.
+    void clear();
+    
+    // Events that did not fit into a full lane
+    uint64_t getDroppedCount() const;
+    
+    // Write everything as Chrome trace JSON (chrome://tracing or ui.perfetto.dev)
+    bool exportChromeTrace(const std::string& path) const;
+    
+    // Records an event for the lifetime of the object
+    class Scope {
+    private:
+        const char* name_;
+        int64_t start_;
+        
+    public:
+        explicit Scope(const char* name);
+        ~Scope();
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+    };
+    
+private:
+    using Clock = std::chrono::steady_clock;
+    
+    // Fixed capacity, so recording never allocates
+    struct Lane {
+        std::unique_ptr<Event[]> events;
+        std::atomic<size_t> size{0};
+    };
+    
+    // Gives a lane back to the free list when its thread exits
+    struct LaneOwner {
+        Lane* lane = nullptr;
+        ~LaneOwner();
+    };
+    
+    Clock::time_point epoch_;
+    // Guards lanes_ and freeLanes_, not the events inside a lane
+    mutable std::mutex lanesMutex_;
+    std::vector<std::unique_ptr<Lane>> lanes_;
+    std::vector<Lane*> freeLanes_;
+    std::atomic<uint64_t> dropped_{0};
+    
+    PhaseTracer();
+    
+    // The calling thread's lane, acquired on first use
+    Lane& currentLane();
+    Lane* acquireLane();
+    void releaseLane(Lane* lane);
+};
+
+#ifdef MERGE_TRACING
+#define TRACE_CONCAT_INNER(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_INNER(a, b)
+#define TRACE_SCOPE(name) PhaseTracer::Scope TRACE_CONCAT(traceScope_, __LINE__)(name)
+#define TRACE_TIMESTAMP(var) const int64_t var = PhaseTracer::instance().now()
+#define TRACE_RECORD(name, startNs, endNs) PhaseTracer::instance().record(name, startNs, endNs)
+#else
+#define TRACE_SCOPE(name) ((void)0)
+#define TRACE_TIMESTAMP(var) ((void)0)
+#define TRACE_RECORD(name, startNs, endNs) ((void)0)
+#endif
+
+#endif // PHASE_TRACER_H
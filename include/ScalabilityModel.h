@@ -0,0 +1,49 @@
+// ScalabilityModel.h
+// Amdahl and Universal Scalability Law fits for scaling measurements
+
+#ifndef SCALABILITY_MODEL_H
+#define SCALABILITY_MODEL_H
+
+#include <vector>
+
+// One measured point: relative capacity C(N) at N threads.
+// Strong scaling: C(N) = T(1) / T(N)
+// Weak scaling:   C(N) = N * T(1) / T(N)   (throughput relative to 1 thread)
+struct ScalingPoint {
+    int threads;
+    double capacity;
+};
+
+// Amdahl's law: C(N) = 1 / (s + (1 - s) / N)
+struct AmdahlFit {
+    double serialFraction;
+    double rSquared;
+    
+    double predict(int threads) const;
+    
+    // Upper bound on speedup with infinite threads (1 / s)
+    double maxSpeedup() const;
+};
+
+// Universal Scalability Law: C(N) = N / (1 + sigma * (N - 1) + kappa * N * (N - 1))
+// sigma = contention (serialization), kappa = coherency (crosstalk) cost
+struct UslFit {
+    double sigma;
+    double kappa;
+    double rSquared;
+    
+    double predict(int threads) const;
+    
+    // Thread count where capacity peaks (0 if it never peaks, i.e. kappa == 0)
+    double peakThreads() const;
+};
+
+// Least-squares fitting of the two models
+class ScalabilityModel {
+public:
+    static AmdahlFit fitAmdahl(const std::vector<ScalingPoint>& points);
+    
+    static UslFit fitUsl(const std::vector<ScalingPoint>& points);
+};
+
+#endif // SCALABILITY_MODEL_H
@@ -0,0 +1,124 @@
+// SharedMemoryMergeStrategy.h
+// Parallel merge done by separate worker processes over POSIX shared memory
+
+#ifndef SHARED_MEMORY_MERGE_STRATEGY_H
+#define SHARED_MEMORY_MERGE_STRATEGY_H
+
+#include "IMergeStrategy.h"
+#include <cstddef>
+#include <memory>
+
+// One named shared memory segment (shm_open + mmap) holding a header,
+// the partition table, both inputs and the output. The name stays valid
+// until the segment is destroyed, so worker processes that were started
+// earlier can open it and merge their slice straight into the output.
+// If the process is killed the name is left behind in /dev/shm.
+class SharedMergeSegment {
+private:
+    struct Header;
+    struct Partition;
+    
+    std::string name_;
+    void* base_;
+    size_t mappedBytes_;
+    Header* header_;
+    Partition* partitions_;
+    int* input1_;
+    int* input2_;
+    int* output_;
+    
+public:
+    SharedMergeSegment(size_t size1, size_t size2, int numWorkers);
+    ~SharedMergeSegment();
+    
+    SharedMergeSegment(const SharedMergeSegment&) = delete;
+    SharedMergeSegment& operator=(const SharedMergeSegment&) = delete;
+    
+    // Inputs must be filled (sorted) before the segment is merged
+    int* input1();
+    int* input2();
+    
+    // Valid after MergeWorkerPool::run()
+    const int* output() const;
+    
+    size_t size1() const;
+    size_t size2() const;
+    int getWorkerCount() const;
+    const std::string& getName() const;
+    
+    // Split the inputs for the workers (same split as ParallelMergeStrategy).
+    // Called by MergeWorkerPool::run() before the workers are woken up.
+    void partition();
+    
+    // Worker side: merge slice `worker` of a segment mapped at base.
+    // Returns false if the mapping is not a valid segment for that worker.
+    // Does not allocate, it runs in forked worker processes.
+    static bool mergeSlice(void* base, size_t mappedBytes, int worker);
+};
+
+// K worker processes, forked once and reused for every merge.
+// Algorithm:
+// 1. Coordinator partitions the segment, publishes its name in a shared
+//    control block and bumps a job counter (futex), waking the workers
+// 2. Each worker opens the segment by name, maps it (the mapping is kept
+//    until a different segment comes along) and merges its slice
+// 3. Each worker decrements a counter in shared memory and wakes the
+//    coordinator with a futex; the coordinator sleeps until it hits 0
+// A worker that dies is detected with waitpid; the pool then stops and
+// run() throws. Workers are forked from the whole process, so create the
+// pool before allocating big buffers: pages that exist at fork time are
+// copy-on-write in the parent afterwards. Only available on Linux (futex),
+// see SharedMemoryMergeStrategy::isSupported().
+class MergeWorkerPool {
+private:
+    struct ControlBlock;
+    
+    ControlBlock* control_;
+    std::vector<int> workerPids_;
+    bool stopped_;
+    
+    // Wake the workers with the shutdown flag set (or kill them) and reap them
+    void stop(bool force);
+    
+public:
+    explicit MergeWorkerPool(int numWorkers);
+    ~MergeWorkerPool();
+    
+    MergeWorkerPool(const MergeWorkerPool&) = delete;
+    MergeWorkerPool& operator=(const MergeWorkerPool&) = delete;
+    
+    int getWorkerCount() const;
+    
+    // Partition the segment and merge it with the workers. The segment must be
+    // made for this many workers. Throws std::runtime_error if a worker fails.
+    void run(SharedMergeSegment& segment);
+};
+
+// IMergeStrategy wrapper: copies the vectors into a segment, runs the
+// worker pool and copies the result out. The pool is forked once in the
+// constructor; the segment is kept and reused while the input sizes stay
+// the same. The copies are part of what process isolation costs.
+class SharedMemoryMergeStrategy : public IMergeStrategy {
+private:
+    int numWorkers_;
+    std::unique_ptr<MergeWorkerPool> pool_;
+    std::unique_ptr<SharedMergeSegment> segment_;
+    
+public:
+    explicit SharedMemoryMergeStrategy(int K);
+    
+    std::vector<int> merge(const std::vector<int>& vec1,
+                          const std::vector<int>& vec2) override;
+    
+    // Merge a segment the caller already filled, with this strategy's workers
+    void mergeSegment(SharedMergeSegment& segment);
+    
+    std::string getName() const override;
+    
+    int getWorkerCount() const;
+    
+    // True if this platform has shm_open, fork and futex
+    static bool isSupported();
+};
+
+#endif // SHARED_MEMORY_MERGE_STRATEGY_H
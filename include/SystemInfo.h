@@ -4,11 +4,19 @@
 #ifndef SYSTEM_INFO_H
 #define SYSTEM_INFO_H
 
+#include <cstddef>
+
 // Simple class to get CPU info
 class SystemInfo {
 public:
     // Returns number of hardware threads available on this CPU
     static unsigned int getHardwareThreads();
+    
+    // Returns size of the per-core L2 cache in bytes
+    static size_t getL2CacheSize();
+    
+    // Returns size of the last level cache (L3 if present, otherwise L2) in bytes
+    static size_t getLastLevelCacheSize();
 };
 
 #endif // SYSTEM_INFO_H
@@ -0,0 +1,96 @@
+// TieredMergeIndex.h
+// Incrementally growing sorted dataset (LSM-style tiered runs)
+
+#ifndef TIERED_MERGE_INDEX_H
+#define TIERED_MERGE_INDEX_H
+
+#include "IMergeStrategy.h"
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Keeps the data as a set of sorted runs grouped in levels, instead of
+// one big vector that is re-merged on every append.
+// - append() just adds the batch as a new run on level 0 (no merging)
+// - when a level has `fanout` runs, a background thread merges them
+//   into one run on the next level using the given merge strategy
+// - lookups and range scans search every run, so they keep working
+//   (and stay correct) while a compaction is running
+// Runs are immutable and shared, so readers only hold the lock long
+// enough to copy the list of runs.
+class TieredMergeIndex {
+public:
+    using Run = std::vector<int>;
+    using RunPtr = std::shared_ptr<const Run>;
+    
+    static constexpr size_t DEFAULT_FANOUT = 4;
+    // append() waits if compaction falls this far behind on level 0
+    static constexpr size_t DEFAULT_MAX_LEVEL0_RUNS = 16;
+    
+    explicit TieredMergeIndex(std::unique_ptr<IMergeStrategy> compactionStrategy,
+                              size_t fanout = DEFAULT_FANOUT,
+                              size_t maxLevel0Runs = DEFAULT_MAX_LEVEL0_RUNS);
+    
+    // Stops the background thread (a running compaction is finished first)
+    ~TieredMergeIndex();
+    
+    TieredMergeIndex(const TieredMergeIndex&) = delete;
+    TieredMergeIndex& operator=(const TieredMergeIndex&) = delete;
+    
+    // Add a sorted batch. Cheap unless compaction is far behind.
+    void append(std::vector<int> sortedBatch);
+    
+    // Is the key present in any run
+    bool contains(int key) const;
+    
+    // How many times the key is present in total
+    size_t count(int key) const;
+    
+    // All elements in [low, high), merged and sorted
+    std::vector<int> rangeScan(int low, int high) const;
+    
+    // Total number of elements
+    size_t size() const;
+    
+    // Number of runs a lookup currently has to search
+    size_t getRunCount() const;
+    
+    // Number of finished compactions
+    size_t getCompactionCount() const;
+    
+    // Block until no level is waiting for compaction
+    void waitForCompaction();
+    
+private:
+    std::unique_ptr<IMergeStrategy> strategy_;
+    size_t fanout_;
+    size_t maxLevel0Runs_;
+    
+    mutable std::mutex mutex_;
+    std::condition_variable workAvailable_;
+    std::condition_variable stateChanged_;
+    // levels_[i] holds runs of level i, oldest first
+    std::vector<std::vector<RunPtr>> levels_;
+    size_t totalSize_ = 0;
+    size_t compactionCount_ = 0;
+    bool compacting_ = false;
+    bool stopping_ = false;
+    
+    std::thread worker_;
+    
+    // Copy of the current run list (taken under the lock)
+    std::vector<RunPtr> snapshot() const;
+    
+    // Lowest level that needs compaction, or -1 (call with the lock held)
+    int findLevelToCompact() const;
+    
+    // Background thread body
+    void compactionLoop();
+    
+    // Merge several runs into one, pairwise with the merge strategy
+    RunPtr mergeRuns(std::vector<RunPtr> runs);
+};
+
+#endif // TIERED_MERGE_INDEX_H
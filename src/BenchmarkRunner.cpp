@@ -3,12 +3,34 @@
 
 #include "../include/BenchmarkRunner.h"
 #include "../include/Timer.h"
+#include "../include/MemoryTracker.h"
 #include "../include/ParallelMergeStrategy.h"
+#include "../include/SharedMemoryMergeStrategy.h"
 #include <iostream>
 #include <iomanip>
 
 namespace {
 	constexpr int PRECISION_TIME = 3;
+
+	void accumulateMemory(MemoryStats& total, const MemoryStats& run) {
+		total.allocations += run.allocations;
+		total.bytesAllocated += run.bytesAllocated;
+		total.peakLiveBytes += run.peakLiveBytes;
+		total.maxRssGrowthBytes += run.maxRssGrowthBytes;
+		total.currentRssBytes += run.currentRssBytes;
+		total.minorFaults += run.minorFaults;
+	}
+
+	MemoryStats averageMemory(const MemoryStats& total, int runs) {
+		MemoryStats average = total;
+		average.allocations /= runs;
+		average.bytesAllocated /= runs;
+		average.peakLiveBytes /= runs;
+		average.maxRssGrowthBytes /= runs;
+		average.currentRssBytes /= runs;
+		average.minorFaults /= runs;
+		return average;
+	}
 }
 
 BenchmarkRunner::BenchmarkRunner(DataGenerator& generator, size_t size, int runs)
@@ -19,26 +41,47 @@ BenchmarkResult BenchmarkRunner::runBenchmark(IMergeStrategy& strategy, double b
     auto vec1 = dataGenerator_.generateSortedData(halfSize);
     auto vec2 = dataGenerator_.generateSortedData(halfSize);
     
+    return runBenchmark(strategy, vec1, vec2, baselineTime);
+}
+
+BenchmarkResult BenchmarkRunner::runBenchmark(IMergeStrategy& strategy, const std::vector<int>& vec1,
+                                              const std::vector<int>& vec2, double baselineTime) {
+    // Get thread count if this is a parallel strategy
+    int threads = 1;
+    if (auto* parallel = dynamic_cast<ParallelMergeStrategy*>(&strategy)) {
+        threads = parallel->getThreadCount();
+    } else if (auto* processes = dynamic_cast<SharedMemoryMergeStrategy*>(&strategy)) {
+        threads = processes->getWorkerCount();
+    }
+    
+    return runBenchmark(strategy.getName(), threads, [&]() {
+        auto result = strategy.merge(vec1, vec2);
+    }, baselineTime);
+}
+
+BenchmarkResult BenchmarkRunner::runBenchmark(const std::string& name, int threadCount,
+                                              const std::function<void()>& mergeOnce, double baselineTime) {
     double totalTime = 0.0;
+    MemoryStats totalMemory;
     
     // Run multiple times and average the results
     for (int run = 0; run < numRuns_; ++run) {
-        double time = Timer::measure([&]() {
-            auto result = strategy.merge(vec1, vec2);
-        });
+        if (MemoryTracker::isEnabled()) {
+            MemoryTracker::beginMeasurement();
+        }
+        double time = Timer::measure(mergeOnce);
         totalTime += time;
+        if (MemoryTracker::isEnabled()) {
+            accumulateMemory(totalMemory, MemoryTracker::endMeasurement());
+        }
     }
     
     double avgTime = totalTime / numRuns_;
     double speedup = (baselineTime > 0) ? baselineTime / avgTime : 1.0;
     
-    // Get thread count if this is a parallel strategy
-    int threads = 1;
-    if (auto* parallel = dynamic_cast<ParallelMergeStrategy*>(&strategy)) {
-        threads = parallel->getThreadCount();
-    }
-    
-    return BenchmarkResult(strategy.getName(), avgTime, speedup, threads);
+    BenchmarkResult result(name, avgTime, speedup, threadCount);
+    result.memory = averageMemory(totalMemory, numRuns_);
+    return result;
 }
 
 BenchmarkResult BenchmarkRunner::runDetailedBenchmark(IMergeStrategy& strategy) {
@@ -54,12 +97,19 @@ BenchmarkResult BenchmarkRunner::runDetailedBenchmark(IMergeStrategy& strategy)
     std::cout << "  Running " << numRuns_ << " test iterations...\n";
     
     double totalTime = 0.0;
+    MemoryStats totalMemory;
     
     for (int run = 0; run < numRuns_; ++run) {
+        if (MemoryTracker::isEnabled()) {
+            MemoryTracker::beginMeasurement();
+        }
         double time = Timer::measure([&]() {
             auto result = strategy.merge(vec1, vec2);
         });
         totalTime += time;
+        if (MemoryTracker::isEnabled()) {
+            accumulateMemory(totalMemory, MemoryTracker::endMeasurement());
+        }
         std::cout << "    Run " << (run + 1) << ": " << std::fixed 
                   << std::setprecision(PRECISION_TIME) << time << " ms\n";
     }
@@ -68,5 +118,7 @@ BenchmarkResult BenchmarkRunner::runDetailedBenchmark(IMergeStrategy& strategy)
     std::cout << "  Average: " << std::fixed << std::setprecision(PRECISION_TIME) 
               << avgTime << " ms\n";
     
-    return BenchmarkResult(strategy.getName(), avgTime, 1.0);
+    BenchmarkResult result(strategy.getName(), avgTime, 1.0);
+    result.memory = averageMemory(totalMemory, numRuns_);
+    return result;
 }
@@ -0,0 +1,220 @@
+// CacheBlockedMergeStrategy.cpp
+// Tiled merge kernel with software prefetch and streaming stores
+
+#include "../include/CacheBlockedMergeStrategy.h"
+#include "../include/SystemInfo.h"
+#include "../include/PhaseTracer.h"
+#include <algorithm>
+#include <thread>
+#include <cstdint>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define MERGE_HAS_SSE2 1
+#endif
+
+namespace {
+	constexpr size_t CACHE_LINE_BYTES = 64;
+	constexpr size_t INTS_PER_LINE = CACHE_LINE_BYTES / sizeof(int);
+	// How far ahead of the read position we prefetch (in elements)
+	constexpr size_t PREFETCH_DISTANCE = 8 * INTS_PER_LINE;
+	// Staging tile takes half of L2, the other half is left for the input streams
+	constexpr size_t TILE_FRACTION_OF_L2 = 2;
+	constexpr size_t MIN_TILE_ELEMENTS = 1024;
+
+	inline void prefetchRead(const int* ptr) {
+#if defined(MERGE_HAS_SSE2)
+		_mm_prefetch(reinterpret_cast<const char*>(ptr), _MM_HINT_T0);
+#elif defined(__GNUC__) || defined(__clang__)
+		__builtin_prefetch(ptr, 0, 3);
+#else
+		(void)ptr;
+#endif
+	}
+
+	// Prefetch a little ahead of the current position, without running past the end
+	inline void prefetchAhead(const int* pos, const int* end) {
+		size_t left = static_cast<size_t>(end - pos);
+		if (left > PREFETCH_DISTANCE) {
+			prefetchRead(pos + PREFETCH_DISTANCE);
+		}
+	}
+
+	// Merge `count` elements without bounds checks.
+	// Caller guarantees neither input runs out within them.
+	void mergeUnchecked(const int*& a, const int* aEnd,
+						const int*& b, const int* bEnd,
+						int* out, size_t count) {
+		size_t i = 0;
+		while (i < count) {
+			prefetchAhead(a, aEnd);
+			prefetchAhead(b, bEnd);
+			size_t lineEnd = std::min(i + INTS_PER_LINE, count);
+			for (; i < lineEnd; ++i) {
+				if (*b < *a) {
+					out[i] = *b++;
+				} else {
+					out[i] = *a++;
+				}
+			}
+		}
+	}
+
+	// Merge exactly `count` elements from [a, aEnd) and [b, bEnd) into out.
+	// Advances a and b. Takes from the first range on ties, like std::merge.
+	void mergeTile(const int*& a, const int* aEnd,
+				   const int*& b, const int* bEnd,
+				   int* out, size_t count) {
+		while (count > 0) {
+			size_t aLeft = static_cast<size_t>(aEnd - a);
+			size_t bLeft = static_cast<size_t>(bEnd - b);
+
+			// Once one input is empty the rest is a plain copy
+			if (aLeft == 0 || bLeft == 0) {
+				const int*& rest = (aLeft == 0) ? b : a;
+				std::copy(rest, rest + count, out);
+				rest += count;
+				return;
+			}
+
+			// Merging min(aLeft, bLeft) elements can't exhaust either input,
+			// so that many can go through the unchecked loop
+			size_t n = std::min({ count, aLeft, bLeft });
+			mergeUnchecked(a, aEnd, b, bEnd, out, n);
+			out += n;
+			count -= n;
+		}
+	}
+
+	// Copy a tile to the output bypassing the cache where possible
+	void streamCopy(const int* src, int* dst, size_t count) {
+#if defined(MERGE_HAS_SSE2)
+		size_t i = 0;
+		// Scalar head until the destination is 16-byte aligned
+		while (i < count && (reinterpret_cast<std::uintptr_t>(dst + i) % sizeof(__m128i)) != 0) {
+			dst[i] = src[i];
+			++i;
+		}
+		constexpr size_t INTS_PER_VECTOR = sizeof(__m128i) / sizeof(int);
+		for (; i + INTS_PER_VECTOR <= count; i += INTS_PER_VECTOR) {
+			__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+			_mm_stream_si128(reinterpret_cast<__m128i*>(dst + i), v);
+		}
+		for (; i < count; ++i) {
+			dst[i] = src[i];
+		}
+#else
+		std::copy(src, src + count, dst);
+#endif
+	}
+
+	inline void streamFence() {
+#if defined(MERGE_HAS_SSE2)
+		_mm_sfence();
+#endif
+	}
+
+	// Merge one partition tile by tile
+	void blockedMerge(const int* a, const int* aEnd,
+					  const int* b, const int* bEnd,
+					  int* out, size_t tileElements, bool streaming) {
+		size_t remaining = static_cast<size_t>(aEnd - a) + static_cast<size_t>(bEnd - b);
+
+		if (!streaming) {
+			while (remaining > 0) {
+				size_t n = std::min(tileElements, remaining);
+				mergeTile(a, aEnd, b, bEnd, out, n);
+				out += n;
+				remaining -= n;
+			}
+			return;
+		}
+
+		// Tiles are merged into a cache-resident buffer, then streamed out
+		std::vector<int> staging(std::min(tileElements, remaining));
+		while (remaining > 0) {
+			size_t n = std::min(tileElements, remaining);
+			mergeTile(a, aEnd, b, bEnd, staging.data(), n);
+			streamCopy(staging.data(), out, n);
+			out += n;
+			remaining -= n;
+		}
+		// Make streaming stores visible before the thread is joined
+		streamFence();
+	}
+}
+
+CacheBlockedMergeStrategy::CacheBlockedMergeStrategy(int K)
+    : ParallelMergeStrategy(K),
+      tileElements_(std::max(SystemInfo::getL2CacheSize() / TILE_FRACTION_OF_L2 / sizeof(int),
+                             MIN_TILE_ELEMENTS)),
+      streamingThresholdBytes_(SystemInfo::getLastLevelCacheSize()) {}
+
+std::vector<int> CacheBlockedMergeStrategy::merge(const std::vector<int>& vec1, 
+                                                   const std::vector<int>& vec2) {
+    TRACE_TIMESTAMP(allocateBegin);
+    
+    // std::vector zero-fills here, on the calling thread (see mergeInto)
+    std::vector<int> result(vec1.size() + vec2.size());
+    
+    TRACE_TIMESTAMP(allocateEnd);
+    TRACE_RECORD("allocate", allocateBegin, allocateEnd);
+    
+    mergeInto(vec1.data(), vec1.size(), vec2.data(), vec2.size(), result.data());
+    return result;
+}
+
+void CacheBlockedMergeStrategy::mergeInto(const int* input1, size_t n1,
+                                          const int* input2, size_t n2, int* output) const {
+    int numThreads = getThreadCount();
+    bool streaming = usesStreamingStores(n1 + n2);
+    
+    TRACE_TIMESTAMP(spawnBegin);
+    
+    if (numThreads == 1) {
+        TRACE_SCOPE("merge");
+        blockedMerge(input1, input1 + n1, input2, input2 + n2,
+                     output, tileElements_, streaming);
+        return;
+    }
+    
+    std::vector<std::thread> threads;
+    
+    for (int i = 0; i < numThreads; ++i) {
+        threads.emplace_back([&, i]() {
+            TRACE_TIMESTAMP(workerStart);
+            TRACE_RECORD("thread start", spawnBegin, workerStart);
+            
+            // Same split as ParallelMergeStrategy
+            MergePartition part = computePartition(input1, n1, input2, n2, i, numThreads);
+            
+            TRACE_TIMESTAMP(partitionEnd);
+            TRACE_RECORD("partition", workerStart, partitionEnd);
+            
+            // Partitions are ordered, so each one knows its place in the output.
+            // This worker is the first to touch its slice of the output.
+            blockedMerge(input1 + part.start1, input1 + part.end1,
+                         input2 + part.start2, input2 + part.end2,
+                         output + part.start1 + part.start2, tileElements_, streaming);
+            
+            TRACE_TIMESTAMP(mergeEnd);
+            TRACE_RECORD("merge", partitionEnd, mergeEnd);
+        });
+    }
+    
+    TRACE_TIMESTAMP(joinBegin);
+    TRACE_RECORD("spawn", spawnBegin, joinBegin);
+    for (auto& t : threads) {
+        t.join();
+    }
+    TRACE_TIMESTAMP(joinEnd);
+    TRACE_RECORD("join wait", joinBegin, joinEnd);
+}
+
+std::string CacheBlockedMergeStrategy::getName() const {
+    return "Cache-blocked merge (K=" + std::to_string(getThreadCount()) + ")";
+}
+
+bool CacheBlockedMergeStrategy::usesStreamingStores(size_t outputSize) const {
+    return outputSize * sizeof(int) > streamingThresholdBytes_;
+}
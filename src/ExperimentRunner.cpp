@@ -8,6 +8,10 @@
 #include "../include/BenchmarkRunner.h"
 #include "../include/SequentialMergeStrategy.h"
 #include "../include/ParallelMergeStrategy.h"
+#include "../include/CacheBlockedMergeStrategy.h"
+#include "../include/TieredMergeIndex.h"
+#include "../include/MergeSelection.h"
+#include "../include/SharedMemoryMergeStrategy.h"
 #include <iostream>
 #include <iomanip>
 #include <algorithm>
@@ -18,8 +22,16 @@ namespace {
 	constexpr int DEFAULT_NUM_RUNS = 5;
 	constexpr int SEPARATOR_WIDTH_NARROW = 60;
 	constexpr int SEPARATOR_WIDTH_STANDARD = 70;
+	constexpr int SEPARATOR_WIDTH_WIDE = 80;
+	constexpr int SEPARATOR_WIDTH_INGEST = 96;
 	constexpr int PRECISION_TIME = 3;
 	constexpr int PRECISION_RATIO = 2;
+	// Fitted model parameters are small fractions, they need more digits
+	constexpr int PRECISION_MODEL_PARAM = 4;
+	// USL kappa is usually orders of magnitude smaller than sigma
+	constexpr int PRECISION_KAPPA = 6;
+	constexpr int PRECISION_THREADS = 1;
+	constexpr int PRECISION_PERCENT = 1;
 	
 	// Constants for generating K values to test
 	constexpr int K_BASE_VALUE_1 = 1;
@@ -28,6 +40,53 @@ namespace {
 	constexpr int K_MULTIPLIER_2X = 2;
 	constexpr int K_MULTIPLIER_4X = 4;
 	constexpr unsigned int MIN_THREADS_FOR_HALF_K = 6;
+	
+	constexpr double BYTES_PER_MB = 1024.0 * 1024.0;
+	constexpr double BYTES_PER_GB = 1024.0 * 1024.0 * 1024.0;
+	constexpr double MS_PER_SECOND = 1000.0;
+	
+	// Scaling sweep: about this many points between 1 and 2x CPU threads
+	constexpr unsigned int SCALING_SWEEP_STEPS = 8;
+	constexpr unsigned int SCALING_MAX_THREADS_FACTOR = 2;
+	// Bigger hosts we predict for, as multiples of this machine's threads
+	constexpr unsigned int PREDICTION_HOST_FACTORS[] = { 2, 4, 8 };
+	
+	// Reads issued after every appended batch in Experiment 6
+	constexpr int LOOKUPS_PER_BATCH = 100;
+	constexpr int RANGE_SCANS_PER_BATCH = 10;
+	// Width of a range scan in key space (keys are in [1, 1'000'000])
+	constexpr int RANGE_SCAN_WIDTH = 1000;
+	constexpr double PERCENTILE_99 = 0.99;
+	constexpr double US_PER_MS = 1000.0;
+	constexpr double ELEMENTS_PER_MILLION = 1'000'000.0;
+	
+	// Experiment 7: random page queries and the multi-run variant
+	constexpr int PAGE_QUERIES = 1000;
+	// Upper end of DataGenerator's default value range
+	constexpr int KEY_RANGE_MAX = 1'000'000;
+	constexpr size_t MULTI_RUN_COUNT = 8;
+	// Large slice for the parallel range test, as a fraction of the output
+	constexpr size_t LARGE_SLICE_DIVISOR = 10;
+	constexpr int PRECISION_LATENCY = 2;
+	
+	// Latency statistics in microseconds
+	struct LatencySummary {
+		double average;
+		double p99;
+	};
+	
+	LatencySummary summarizeLatencies(std::vector<double> latenciesMs) {
+		if (latenciesMs.empty()) {
+			return { 0.0, 0.0 };
+		}
+		std::sort(latenciesMs.begin(), latenciesMs.end());
+		double total = 0.0;
+		for (double latency : latenciesMs) {
+			total += latency;
+		}
+		size_t p99Index = static_cast<size_t>(PERCENTILE_99 * (latenciesMs.size() - 1));
+		return { total / latenciesMs.size() * US_PER_MS, latenciesMs[p99Index] * US_PER_MS };
+	}
 }
 
 ExperimentRunner::ExperimentRunner(std::vector<size_t> sizes)
@@ -90,7 +149,7 @@ void ExperimentRunner::runExperiment3_KInvestigation(size_t testSize) {
 		results.push_back(result);
 
 		double ratio = static_cast<double>(K) / cpuThreads;
-		OutputFormatter::printTableRow(K, result.averageTime, result.speedup, ratio);
+		OutputFormatter::printTableRow(K, result.averageTime, result.speedup, ratio, result.memory);
 	}
 
 	std::cout << std::string(SEPARATOR_WIDTH_NARROW, '-') << "\n\n";
@@ -99,6 +158,509 @@ void ExperimentRunner::runExperiment3_KInvestigation(size_t testSize) {
 	analyzeResults(results, cpuThreads);
 }
 
+void ExperimentRunner::runExperiment4_CacheBlockedMerge(const std::vector<size_t>& sizes) {
+	OutputFormatter::printSectionHeader("EXPERIMENT 4: Cache-Blocked Merge with Prefetch and Streaming Stores");
+
+	unsigned int cpuThreads = SystemInfo::getHardwareThreads();
+	size_t l2Size = SystemInfo::getL2CacheSize();
+	size_t llcSize = SystemInfo::getLastLevelCacheSize();
+
+	std::cout << "\nCPU Hardware Threads: " << cpuThreads << "\n";
+	std::cout << "L2 cache: " << std::fixed << std::setprecision(PRECISION_RATIO)
+			  << l2Size / BYTES_PER_MB << " MB, last level cache: "
+			  << llcSize / BYTES_PER_MB << " MB\n";
+	std::cout << "Streaming stores are used when the output is larger than the last level cache.\n";
+
+	for (size_t size : sizes) {
+		std::cout << "\nTest Size: " << size << " elements\n";
+		std::cout << "  Generating test data... ";
+		std::cout.flush();
+		size_t halfSize = size / 2;
+		auto vec1 = dataGenerator_.generateSortedData(halfSize);
+		auto vec2 = dataGenerator_.generateSortedData(halfSize);
+		std::cout << "Done\n";
+
+		CacheBlockedMergeStrategy probe(1);
+		std::cout << "  Output stores: "
+				  << (probe.usesStreamingStores(vec1.size() + vec2.size()) ? "non-temporal (streaming)" : "regular")
+				  << "\n\n";
+
+		SequentialMergeStrategy sequential;
+		ParallelMergeStrategy parallel(static_cast<int>(cpuThreads));
+		CacheBlockedMergeStrategy blockedSingle(1);
+		CacheBlockedMergeStrategy blockedParallel(static_cast<int>(cpuThreads));
+		std::vector<IMergeStrategy*> strategies = { &sequential, &parallel, &blockedSingle, &blockedParallel };
+
+		BenchmarkRunner runner(dataGenerator_, size);
+		double outputBytes = static_cast<double>((vec1.size() + vec2.size()) * sizeof(int));
+		double baselineTime = 0.0;
+
+		OutputFormatter::printStrategyTableHeader();
+		for (IMergeStrategy* strategy : strategies) {
+			auto result = runner.runBenchmark(*strategy, vec1, vec2, baselineTime);
+			if (strategy == &sequential) {
+				baselineTime = result.averageTime;
+				result.speedup = 1.0;
+			}
+			double throughput = outputBytes / BYTES_PER_GB / (result.averageTime / MS_PER_SECOND);
+			OutputFormatter::printStrategyTableRow(result.strategyName, result.averageTime,
+												   result.speedup, throughput, result.memory);
+		}
+
+		// Same kernel writing into fresh, uninitialized storage: no serial
+		// zero-fill, each worker first-touches its own slice of the output
+		auto intoResult = runner.runBenchmark(
+			"Cache-blocked into new[] (K=" + std::to_string(blockedParallel.getThreadCount()) + ")",
+			blockedParallel.getThreadCount(),
+			[&]() {
+				std::unique_ptr<int[]> output(new int[vec1.size() + vec2.size()]);
+				blockedParallel.mergeInto(vec1.data(), vec1.size(), vec2.data(), vec2.size(), output.get());
+			},
+			baselineTime);
+		double intoThroughput = outputBytes / BYTES_PER_GB / (intoResult.averageTime / MS_PER_SECOND);
+		OutputFormatter::printStrategyTableRow(intoResult.strategyName, intoResult.averageTime,
+											   intoResult.speedup, intoThroughput, intoResult.memory);
+		std::cout << std::string(SEPARATOR_WIDTH_WIDE, '-') << "\n";
+	}
+}
+
+void ExperimentRunner::runExperiment5_ScalingStudy(size_t strongScalingSize, size_t weakScalingSizePerThread) {
+	OutputFormatter::printSectionHeader("EXPERIMENT 5: Strong and Weak Scaling with Amdahl / USL Fits");
+
+	unsigned int cpuThreads = SystemInfo::getHardwareThreads();
+	std::vector<int> threadCounts = generateScalingThreadCounts(cpuThreads);
+
+	std::cout << "\nCPU Hardware Threads: " << cpuThreads << "\n";
+	std::cout << "Strong scaling: " << strongScalingSize << " elements for every thread count\n";
+	std::cout << "Weak scaling: " << weakScalingSizePerThread << " elements per thread\n";
+	std::cout << "Capacity = speedup (strong) or throughput relative to 1 thread (weak)\n";
+
+	std::vector<std::pair<std::string, StrategyFactory>> strategies = {
+		{ "Parallel merge", [](int K) { return std::make_unique<ParallelMergeStrategy>(K); } },
+		{ "Cache-blocked merge", [](int K) { return std::make_unique<CacheBlockedMergeStrategy>(K); } }
+	};
+	// Worker processes are forked when the strategy is created, outside the timed runs
+	if (SharedMemoryMergeStrategy::isSupported()) {
+		strategies.push_back({ "Shared-memory processes",
+							   [](int K) { return std::make_unique<SharedMemoryMergeStrategy>(K); } });
+	}
+
+	for (const auto& [name, factory] : strategies) {
+		OutputFormatter::printSubsectionHeader(name + ": strong scaling");
+		runScalingSweep(factory, threadCounts, strongScalingSize, false, cpuThreads);
+
+		OutputFormatter::printSubsectionHeader(name + ": weak scaling");
+		runScalingSweep(factory, threadCounts, weakScalingSizePerThread, true, cpuThreads);
+	}
+}
+
+void ExperimentRunner::runScalingSweep(const StrategyFactory& factory, const std::vector<int>& threadCounts,
+									   size_t baseSize, bool weakScaling, unsigned int cpuThreads) {
+	std::vector<size_t> sizes;
+	std::vector<BenchmarkResult> results;
+
+	// Strong scaling uses the same data for every thread count
+	size_t halfSize = baseSize / 2;
+	std::vector<int> vec1;
+	std::vector<int> vec2;
+	if (!weakScaling) {
+		vec1 = dataGenerator_.generateSortedData(halfSize);
+		vec2 = dataGenerator_.generateSortedData(halfSize);
+	}
+
+	for (int threads : threadCounts) {
+		size_t size = weakScaling ? baseSize * threads : baseSize;
+		if (weakScaling) {
+			vec1 = dataGenerator_.generateSortedData(size / 2);
+			vec2 = dataGenerator_.generateSortedData(size / 2);
+		}
+
+		auto strategy = factory(threads);
+		BenchmarkRunner runner(dataGenerator_, size);
+		results.push_back(runner.runBenchmark(*strategy, vec1, vec2));
+		sizes.push_back(size);
+	}
+
+	// Relative capacity against the 1-thread run (first in the sweep)
+	double baseTime = results.front().averageTime;
+	std::vector<ScalingPoint> points;
+	for (const auto& result : results) {
+		double speedup = baseTime / result.averageTime;
+		double capacity = weakScaling ? speedup * result.threadCount : speedup;
+		points.push_back({ result.threadCount, capacity });
+	}
+
+	AmdahlFit amdahl = ScalabilityModel::fitAmdahl(points);
+	UslFit usl = ScalabilityModel::fitUsl(points);
+
+	OutputFormatter::printScalingTableHeader();
+	for (size_t i = 0; i < results.size(); ++i) {
+		OutputFormatter::printScalingTableRow(points[i].threads, sizes[i], results[i].averageTime,
+											  points[i].capacity, amdahl.predict(points[i].threads),
+											  usl.predict(points[i].threads), results[i].memory);
+	}
+	std::cout << "\n";
+
+	printScalingAnalysis(amdahl, usl, cpuThreads);
+}
+
+void ExperimentRunner::printScalingAnalysis(const AmdahlFit& amdahl, const UslFit& usl, unsigned int cpuThreads) {
+	std::cout << "  Amdahl: serial fraction s = " << std::fixed << std::setprecision(PRECISION_MODEL_PARAM)
+			  << amdahl.serialFraction << " (R^2 = " << std::setprecision(PRECISION_RATIO)
+			  << amdahl.rSquared << "), max capacity ";
+	if (amdahl.serialFraction > 0.0) {
+		std::cout << std::setprecision(PRECISION_RATIO) << amdahl.maxSpeedup() << "x\n";
+	} else {
+		std::cout << "unbounded\n";
+	}
+
+	std::cout << "  USL: contention sigma = " << std::setprecision(PRECISION_MODEL_PARAM) << usl.sigma
+			  << ", coherency kappa = " << std::setprecision(PRECISION_KAPPA) << usl.kappa
+			  << " (R^2 = " << std::setprecision(PRECISION_RATIO) << usl.rSquared << ")\n";
+	if (usl.peakThreads() > 0.0) {
+		std::cout << "  USL peak at about " << std::setprecision(PRECISION_THREADS) << usl.peakThreads()
+				  << " threads (" << std::setprecision(PRECISION_RATIO)
+				  << usl.predict(static_cast<int>(usl.peakThreads() + 0.5)) << "x)\n";
+	} else if (usl.sigma <= 0.0) {
+		std::cout << "  USL: no contention or coherency cost measured, capacity unbounded\n";
+	} else if (usl.sigma < 1.0) {
+		std::cout << "  USL: no coherency cost measured, capacity approaches "
+				  << std::setprecision(PRECISION_RATIO) << 1.0 / usl.sigma << "x\n";
+	} else {
+		std::cout << "  USL: fully serialized, extra threads do not add capacity\n";
+	}
+
+	std::cout << "  Predicted capacity on bigger hosts:\n";
+	for (unsigned int factor : PREDICTION_HOST_FACTORS) {
+		int threads = static_cast<int>(cpuThreads * factor);
+		std::cout << "    " << std::setw(5) << threads << " threads: Amdahl "
+				  << std::setprecision(PRECISION_RATIO) << amdahl.predict(threads)
+				  << "x, USL " << usl.predict(threads) << "x\n";
+	}
+}
+
+void ExperimentRunner::runExperiment6_IncrementalIndex(size_t batchSize, int batchCount) {
+	OutputFormatter::printSectionHeader("EXPERIMENT 6: Incremental Index - Tiered Runs vs. Merge on Every Append");
+
+	unsigned int cpuThreads = SystemInfo::getHardwareThreads();
+	std::cout << "\nAppending " << batchCount << " sorted batches of " << batchSize << " elements\n";
+	std::cout << "After each batch: " << LOOKUPS_PER_BATCH << " point lookups and "
+			  << RANGE_SCANS_PER_BATCH << " range scans (width " << RANGE_SCAN_WIDTH << ")\n";
+	std::cout << "Both approaches merge with Parallel merge (K=" << cpuThreads << ")\n";
+	std::cout << "Ingest rate = elements / wall-clock from the first append until compaction has drained,\n"
+			  << "reads included (background compaction overlaps them)\n";
+
+	// Same batches and queries for both approaches
+	std::cout << "\nGenerating batches and queries... ";
+	std::cout.flush();
+	std::vector<std::vector<int>> batches;
+	for (int i = 0; i < batchCount; ++i) {
+		batches.push_back(dataGenerator_.generateSortedData(batchSize));
+	}
+	auto lookupKeys = dataGenerator_.generateUnsortedData(static_cast<size_t>(batchCount) * LOOKUPS_PER_BATCH);
+	auto scanStarts = dataGenerator_.generateUnsortedData(static_cast<size_t>(batchCount) * RANGE_SCANS_PER_BATCH);
+	std::cout << "Done\n\n";
+
+	double totalElements = static_cast<double>(batchSize) * batchCount;
+	// Keeps the compiler from dropping the lookups
+	size_t checksum = 0;
+
+	// [1] Naive: one merged vector, re-merged on every append
+	std::vector<double> naiveLookups;
+	std::vector<double> naiveScans;
+	double naiveWallMs = 0.0;
+	{
+		ParallelMergeStrategy strategy(static_cast<int>(cpuThreads));
+		std::vector<int> merged;
+
+		naiveWallMs = Timer::measure([&]() {
+			for (int i = 0; i < batchCount; ++i) {
+				merged = strategy.merge(merged, batches[i]);
+
+				for (int q = 0; q < LOOKUPS_PER_BATCH; ++q) {
+					int key = lookupKeys[static_cast<size_t>(i) * LOOKUPS_PER_BATCH + q];
+					naiveLookups.push_back(Timer::measure([&]() {
+						checksum += std::binary_search(merged.begin(), merged.end(), key) ? 1 : 0;
+					}));
+				}
+				for (int q = 0; q < RANGE_SCANS_PER_BATCH; ++q) {
+					int low = scanStarts[static_cast<size_t>(i) * RANGE_SCANS_PER_BATCH + q];
+					naiveScans.push_back(Timer::measure([&]() {
+						auto first = std::lower_bound(merged.begin(), merged.end(), low);
+						auto last = std::lower_bound(first, merged.end(), low + RANGE_SCAN_WIDTH);
+						std::vector<int> scan(first, last);
+						checksum += scan.size();
+					}));
+				}
+			}
+		});
+	}
+
+	// [2] Tiered runs, compaction in the background while reads go on.
+	// Timing only append() would miss the compaction work that overlaps the
+	// reads, so the whole loop is timed, up to the compaction drain.
+	std::vector<double> tieredLookups;
+	std::vector<double> tieredScans;
+	double tieredWallMs = 0.0;
+	size_t finalRuns = 0;
+	size_t compactions = 0;
+	{
+		TieredMergeIndex index(std::make_unique<ParallelMergeStrategy>(static_cast<int>(cpuThreads)));
+
+		tieredWallMs = Timer::measure([&]() {
+			for (int i = 0; i < batchCount; ++i) {
+				// The naive version is done with the batches, so they can be handed over
+				index.append(std::move(batches[i]));
+
+				for (int q = 0; q < LOOKUPS_PER_BATCH; ++q) {
+					int key = lookupKeys[static_cast<size_t>(i) * LOOKUPS_PER_BATCH + q];
+					tieredLookups.push_back(Timer::measure([&]() {
+						checksum += index.contains(key) ? 1 : 0;
+					}));
+				}
+				for (int q = 0; q < RANGE_SCANS_PER_BATCH; ++q) {
+					int low = scanStarts[static_cast<size_t>(i) * RANGE_SCANS_PER_BATCH + q];
+					tieredScans.push_back(Timer::measure([&]() {
+						checksum += index.rangeScan(low, low + RANGE_SCAN_WIDTH).size();
+					}));
+				}
+			}
+			index.waitForCompaction();
+		});
+		finalRuns = index.getRunCount();
+		compactions = index.getCompactionCount();
+	}
+
+	auto naiveLookup = summarizeLatencies(naiveLookups);
+	auto naiveScan = summarizeLatencies(naiveScans);
+	auto tieredLookup = summarizeLatencies(tieredLookups);
+	auto tieredScan = summarizeLatencies(tieredScans);
+
+	double naiveRate = totalElements / ELEMENTS_PER_MILLION / (naiveWallMs / MS_PER_SECOND);
+	double tieredRate = totalElements / ELEMENTS_PER_MILLION / (tieredWallMs / MS_PER_SECOND);
+
+	OutputFormatter::printIngestTableHeader();
+	OutputFormatter::printIngestTableRow("Merge on every append", naiveRate,
+										 naiveLookup.average, naiveLookup.p99, naiveScan.average, naiveScan.p99);
+	OutputFormatter::printIngestTableRow("Tiered runs + compaction", tieredRate,
+										 tieredLookup.average, tieredLookup.p99, tieredScan.average, tieredScan.p99);
+	std::cout << std::string(SEPARATOR_WIDTH_INGEST, '-') << "\n\n";
+
+	std::cout << "  Wall-clock, first append to drained compaction: " << std::fixed
+			  << std::setprecision(PRECISION_TIME) << naiveWallMs << " ms naive, "
+			  << tieredWallMs << " ms tiered\n";
+	std::cout << "  Ingest speedup: " << std::setprecision(PRECISION_RATIO)
+			  << tieredRate / naiveRate << "x\n";
+	std::cout << "  Tiered index: " << compactions << " compactions, "
+			  << finalRuns << " runs searched per lookup at the end\n";
+	std::cout << "  (checksum " << checksum << ")\n";
+}
+
+void ExperimentRunner::runExperiment7_PartialMerge(size_t size, size_t pageSize) {
+	OutputFormatter::printSectionHeader("EXPERIMENT 7: Partial Merge - k-th Element and Output Pages via Co-Rank");
+
+	unsigned int cpuThreads = SystemInfo::getHardwareThreads();
+	std::cout << "\nTest Size: " << size << " elements, page size " << pageSize << "\n";
+	std::cout << "  Generating test data... ";
+	std::cout.flush();
+	size_t halfSize = size / 2;
+	auto vec1 = dataGenerator_.generateSortedData(halfSize);
+	auto vec2 = dataGenerator_.generateSortedData(halfSize);
+	size_t total = vec1.size() + vec2.size();
+	auto offsets = dataGenerator_.generateUnsortedData(PAGE_QUERIES);
+	std::cout << "Done\n\n";
+
+	// Reference: full merge, also used to check the answers
+	std::vector<int> fullMerge;
+	double fullTime = Timer::measure([&]() {
+		fullMerge = SequentialMergeStrategy().merge(vec1, vec2);
+	});
+	std::cout << "  [1] Full merge (Sequential std::merge): " << std::fixed
+			  << std::setprecision(PRECISION_TIME) << fullTime << " ms\n\n";
+
+	bool allMatch = true;
+	// Random keys are in [1, KEY_RANGE_MAX], scale them to offsets over the whole output
+	auto pageOffset = [&](int q, size_t outputSize) {
+		double fraction = static_cast<double>(offsets[q] - 1) / KEY_RANGE_MAX;
+		return static_cast<size_t>(fraction * (outputSize - pageSize));
+	};
+
+	// [2] Random pages
+	double pageTime = 0.0;
+	for (int q = 0; q < PAGE_QUERIES; ++q) {
+		size_t offset = pageOffset(q, total);
+		std::vector<int> page;
+		pageTime += Timer::measure([&]() {
+			page = MergeSelection::mergeRange(vec1, vec2, offset, offset + pageSize);
+		});
+		allMatch = allMatch && std::equal(page.begin(), page.end(), fullMerge.begin() + offset);
+	}
+	double avgPage = pageTime / PAGE_QUERIES;
+	std::cout << "  [2] Page of " << pageSize << " at random offset (" << PAGE_QUERIES << " queries):\n";
+	std::cout << "      Average: " << std::setprecision(PRECISION_LATENCY) << avgPage * US_PER_MS
+			  << " us (vs full merge: " << std::setprecision(PRECISION_RATIO) << fullTime / avgPage << "x)\n\n";
+
+	// [3] Top-N
+	std::vector<int> topN;
+	double topTime = Timer::measure([&]() {
+		topN = MergeSelection::mergeRange(vec1, vec2, 0, pageSize);
+	});
+	allMatch = allMatch && std::equal(topN.begin(), topN.end(), fullMerge.begin());
+	std::cout << "  [3] Top " << pageSize << ": " << std::setprecision(PRECISION_LATENCY)
+			  << topTime * US_PER_MS << " us\n\n";
+
+	// [4] Median of the union
+	int median = 0;
+	double medianTime = Timer::measure([&]() {
+		median = MergeSelection::selectKth(vec1, vec2, (total - 1) / 2);
+	});
+	allMatch = allMatch && (median == fullMerge[(total - 1) / 2]);
+	std::cout << "  [4] Median (" << median << "): " << std::setprecision(PRECISION_LATENCY)
+			  << medianTime * US_PER_MS << " us\n\n";
+
+	// [5] Large slice, sequential vs parallel
+	size_t sliceBegin = total / LARGE_SLICE_DIVISOR;
+	size_t sliceEnd = sliceBegin + total / LARGE_SLICE_DIVISOR;
+	std::vector<int> slice;
+	double sliceSeqTime = Timer::measure([&]() {
+		slice = MergeSelection::mergeRange(vec1, vec2, sliceBegin, sliceEnd);
+	});
+	double slicePar = Timer::measure([&]() {
+		slice = MergeSelection::mergeRange(vec1, vec2, sliceBegin, sliceEnd, static_cast<int>(cpuThreads));
+	});
+	allMatch = allMatch && std::equal(slice.begin(), slice.end(), fullMerge.begin() + sliceBegin);
+	std::cout << "  [5] Slice of " << (sliceEnd - sliceBegin) << " elements:\n";
+	std::cout << "      Sequential: " << std::setprecision(PRECISION_TIME) << sliceSeqTime << " ms, "
+			  << "K=" << cpuThreads << ": " << slicePar << " ms\n\n";
+
+	// [6] Same page query over many runs
+	std::vector<std::vector<int>> runs;
+	for (size_t r = 0; r < MULTI_RUN_COUNT; ++r) {
+		runs.push_back(dataGenerator_.generateSortedData(size / MULTI_RUN_COUNT));
+	}
+	std::vector<int> allRuns;
+	for (const auto& run : runs) {
+		allRuns.insert(allRuns.end(), run.begin(), run.end());
+	}
+	std::sort(allRuns.begin(), allRuns.end());
+
+	double multiPageTime = 0.0;
+	for (int q = 0; q < PAGE_QUERIES; ++q) {
+		size_t offset = pageOffset(q, allRuns.size());
+		std::vector<int> page;
+		multiPageTime += Timer::measure([&]() {
+			page = MergeSelection::mergeRange(runs, offset, offset + pageSize);
+		});
+		allMatch = allMatch && std::equal(page.begin(), page.end(), allRuns.begin() + offset);
+	}
+	std::cout << "  [6] Page of " << pageSize << " over " << MULTI_RUN_COUNT << " runs: "
+			  << std::setprecision(PRECISION_LATENCY) << multiPageTime / PAGE_QUERIES * US_PER_MS << " us average\n\n";
+
+	std::cout << "  Results match full merge: " << (allMatch ? "yes" : "NO") << "\n";
+}
+
+void ExperimentRunner::runExperiment8_ProcessIsolation() {
+	OutputFormatter::printSectionHeader("EXPERIMENT 8: Shared-Memory Worker Processes vs. Threads");
+
+	if (!SharedMemoryMergeStrategy::isSupported()) {
+		std::cout << "\n  Note: Shared memory worker processes need Linux (shm_open, fork, futex).\n";
+		std::cout << "        This experiment is skipped.\n\n";
+		return;
+	}
+
+	unsigned int cpuThreads = SystemInfo::getHardwareThreads();
+	int K = static_cast<int>(cpuThreads);
+	std::cout << "\nCPU Hardware Threads: " << cpuThreads << " (K = " << K << " threads / processes)\n";
+	std::cout << "Worker processes are started once and reused for every run.\n";
+	std::cout << "End-to-end includes copying the inputs into shared memory and the result out.\n";
+	std::cout << "Merge only starts with the inputs already in shared memory (futex wake + merge + futex wait).\n";
+
+	// Fork the workers before any test data exists, so the parent doesn't take
+	// copy-on-write faults on the data afterwards
+	SharedMemoryMergeStrategy processes(K);
+
+	for (size_t size : testSizes_) {
+		std::cout << "\nTest Size: " << size << " elements\n";
+		size_t halfSize = size / 2;
+		auto vec1 = dataGenerator_.generateSortedData(halfSize);
+		auto vec2 = dataGenerator_.generateSortedData(halfSize);
+		double outputBytes = static_cast<double>((vec1.size() + vec2.size()) * sizeof(int));
+
+		BenchmarkRunner runner(dataGenerator_, size);
+		ParallelMergeStrategy threads(K);
+
+		auto threadResult = runner.runBenchmark(threads, vec1, vec2);
+		double baselineTime = threadResult.averageTime;
+		auto processResult = runner.runBenchmark(processes, vec1, vec2, baselineTime);
+
+		// Merge only: a fresh segment per run (so page faults on the output count,
+		// like the thread version allocating its result), filled outside the timer.
+		// Memory is measured from the segment's creation, so it shows up as allocated.
+		double totalMergeOnly = 0.0;
+		MemoryStats mergeOnlyMemory;
+		for (int run = 0; run < DEFAULT_NUM_RUNS; ++run) {
+			if (MemoryTracker::isEnabled()) {
+				MemoryTracker::beginMeasurement();
+			}
+			{
+				SharedMergeSegment segment(vec1.size(), vec2.size(), K);
+				std::copy(vec1.begin(), vec1.end(), segment.input1());
+				std::copy(vec2.begin(), vec2.end(), segment.input2());
+				totalMergeOnly += Timer::measure([&]() {
+					processes.mergeSegment(segment);
+				});
+			}
+			if (MemoryTracker::isEnabled()) {
+				MemoryStats run = MemoryTracker::endMeasurement();
+				mergeOnlyMemory.allocations += run.allocations / DEFAULT_NUM_RUNS;
+				mergeOnlyMemory.bytesAllocated += run.bytesAllocated / DEFAULT_NUM_RUNS;
+				mergeOnlyMemory.peakLiveBytes += run.peakLiveBytes / DEFAULT_NUM_RUNS;
+				mergeOnlyMemory.maxRssGrowthBytes += run.maxRssGrowthBytes / DEFAULT_NUM_RUNS;
+				mergeOnlyMemory.currentRssBytes += run.currentRssBytes / DEFAULT_NUM_RUNS;
+				mergeOnlyMemory.minorFaults += run.minorFaults / DEFAULT_NUM_RUNS;
+			}
+		}
+		double avgMergeOnly = totalMergeOnly / DEFAULT_NUM_RUNS;
+
+		auto throughput = [&](double timeMs) {
+			return outputBytes / BYTES_PER_GB / (timeMs / MS_PER_SECOND);
+		};
+
+		OutputFormatter::printStrategyTableHeader();
+		OutputFormatter::printStrategyTableRow(threadResult.strategyName, threadResult.averageTime,
+											   1.0, throughput(threadResult.averageTime), threadResult.memory);
+		OutputFormatter::printStrategyTableRow(processResult.strategyName + " e2e", processResult.averageTime,
+											   processResult.speedup, throughput(processResult.averageTime),
+											   processResult.memory);
+		OutputFormatter::printStrategyTableRow("  merge only", avgMergeOnly,
+											   baselineTime / avgMergeOnly, throughput(avgMergeOnly), mergeOnlyMemory);
+		std::cout << std::string(SEPARATOR_WIDTH_WIDE, '-') << "\n";
+
+		std::cout << "  Isolation overhead vs threads: " << std::fixed << std::setprecision(PRECISION_TIME)
+				  << processResult.averageTime - baselineTime << " ms end-to-end, "
+				  << avgMergeOnly - baselineTime << " ms merge only\n";
+	}
+}
+
+std::vector<int> ExperimentRunner::generateScalingThreadCounts(unsigned int cpuThreads) {
+	unsigned int maxThreads = cpuThreads * SCALING_MAX_THREADS_FACTOR;
+	unsigned int step = std::max(1u, cpuThreads / (SCALING_SWEEP_STEPS / SCALING_MAX_THREADS_FACTOR));
+
+	// Always start from 1 thread, it is the reference point for the fits
+	std::vector<int> counts = { 1 };
+	for (unsigned int threads = step; threads <= maxThreads; threads += step) {
+		if (threads > 1) {
+			counts.push_back(static_cast<int>(threads));
+		}
+	}
+	// Make sure the exact CPU thread count is measured
+	if (std::find(counts.begin(), counts.end(), static_cast<int>(cpuThreads)) == counts.end()) {
+		counts.push_back(static_cast<int>(cpuThreads));
+		std::sort(counts.begin(), counts.end());
+	}
+	return counts;
+}
+
 void ExperimentRunner::testMergeWithPolicies(size_t size) {
 	std::cout << "\n  Testing std::merge with different execution policies.\n";
 	std::cout << "  Using two separate sorted vectors merged into output buffer.\n\n";
@@ -244,6 +806,15 @@ void ExperimentRunner::analyzeResults(const std::vector<BenchmarkResult>& result
 	std::cout << "  K / CPU_threads: " << std::fixed << std::setprecision(PRECISION_RATIO)
 			  << bestRatio << "\n";
 
+	// Fit the K sweep with Amdahl's law to put a number on the overhead
+	std::vector<ScalingPoint> points;
+	for (const auto& result : results) {
+		points.push_back({ result.threadCount, result.speedup });
+	}
+	AmdahlFit amdahl = ScalabilityModel::fitAmdahl(points);
+	std::cout << "  Estimated serial fraction (Amdahl): " << std::fixed << std::setprecision(PRECISION_MODEL_PARAM)
+			  << amdahl.serialFraction << "\n";
+
 	// Try to understand what we're seeing
 	std::cout << "\n  Observations:\n";
 	if (best.threadCount < static_cast<int>(cpuThreads)) {
@@ -261,7 +832,7 @@ void ExperimentRunner::analyzeResults(const std::vector<BenchmarkResult>& result
 	if (results.size() > 1 && results.back().averageTime > best.averageTime) {
 		double degradation = ((results.back().averageTime / best.averageTime) - 1.0) * 100.0;
 		std::cout << "    - Performance drops by " << std::fixed
-				  << std::setprecision(1) << degradation << "% at highest K\n";
+				  << std::setprecision(PRECISION_PERCENT) << degradation << "% at highest K\n";
 		std::cout << "    - Too many threads cause overhead\n";
 	}
 }
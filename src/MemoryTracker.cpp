@@ -0,0 +1,188 @@
+// MemoryTracker.cpp
+// Allocation counters, global operator new/delete hooks and getrusage sampling
+
+#include "../include/MemoryTracker.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#include <psapi.h>
+#ifdef _MSC_VER
+#pragma comment(lib, "psapi.lib")
+#endif
+#else
+#include <sys/resource.h>
+#include <unistd.h>
+#include <cstdio>
+#endif
+
+namespace {
+	std::atomic<uint64_t> allocationCount{0};
+	std::atomic<uint64_t> allocatedBytes{0};
+	std::atomic<int64_t> liveBytes{0};
+	std::atomic<int64_t> peakLiveBytes{0};
+	std::atomic<bool> externalWork{false};
+
+	// Values at beginMeasurement()
+	uint64_t startAllocations = 0;
+	uint64_t startAllocatedBytes = 0;
+	int64_t startLiveBytes = 0;
+	uint64_t startMinorFaults = 0;
+	uint64_t startPeakRssBytes = 0;
+
+	// ru_maxrss is in kilobytes on Linux
+	constexpr uint64_t BYTES_PER_KB = 1024;
+
+#if !defined(_WIN32)
+	// Resident pages from /proc/self/statm (second field), 0 where there is no /proc.
+	// Uses stdio rather than iostreams so the read itself doesn't go through operator new.
+	uint64_t currentRssBytes() {
+		std::FILE* statm = std::fopen("/proc/self/statm", "r");
+		if (!statm) {
+			return 0;
+		}
+		unsigned long long totalPages = 0;
+		unsigned long long residentPages = 0;
+		int fields = std::fscanf(statm, "%llu %llu", &totalPages, &residentPages);
+		std::fclose(statm);
+		if (fields != 2) {
+			return 0;
+		}
+		return static_cast<uint64_t>(residentPages) * static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+	}
+#endif
+}
+
+void MemoryTracker::recordAllocation(size_t bytes) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    allocatedBytes.fetch_add(bytes, std::memory_order_relaxed);
+    int64_t live = liveBytes.fetch_add(static_cast<int64_t>(bytes), std::memory_order_relaxed)
+                   + static_cast<int64_t>(bytes);
+    
+    // Raise the peak if we went above it
+    int64_t peak = peakLiveBytes.load(std::memory_order_relaxed);
+    while (live > peak && !peakLiveBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+    }
+}
+
+void MemoryTracker::recordDeallocation(size_t bytes) {
+    liveBytes.fetch_sub(static_cast<int64_t>(bytes), std::memory_order_relaxed);
+}
+
+void MemoryTracker::recordExternalWork() {
+    externalWork.store(true, std::memory_order_relaxed);
+}
+
+void MemoryTracker::beginMeasurement() {
+    externalWork.store(false, std::memory_order_relaxed);
+    startAllocations = allocationCount.load(std::memory_order_relaxed);
+    startAllocatedBytes = allocatedBytes.load(std::memory_order_relaxed);
+    startLiveBytes = liveBytes.load(std::memory_order_relaxed);
+    peakLiveBytes.store(startLiveBytes, std::memory_order_relaxed);
+    ProcessSample process = sampleProcess();
+    startMinorFaults = process.minorFaults;
+    startPeakRssBytes = process.peakRssBytes;
+}
+
+MemoryStats MemoryTracker::endMeasurement() {
+    ProcessSample process = sampleProcess();
+    
+    MemoryStats stats;
+    stats.allocations = static_cast<double>(allocationCount.load(std::memory_order_relaxed) - startAllocations);
+    stats.bytesAllocated = static_cast<double>(allocatedBytes.load(std::memory_order_relaxed) - startAllocatedBytes);
+    stats.peakLiveBytes = static_cast<double>(peakLiveBytes.load(std::memory_order_relaxed) - startLiveBytes);
+    // The high-water mark is process-wide and never drops, so only the part
+    // this run added says anything about the run
+    stats.maxRssGrowthBytes = static_cast<double>(process.peakRssBytes - startPeakRssBytes);
+    stats.currentRssBytes = static_cast<double>(process.currentRssBytes);
+    stats.minorFaults = externalWork.load(std::memory_order_relaxed)
+        ? notMeasured()
+        : static_cast<double>(process.minorFaults - startMinorFaults);
+    return stats;
+}
+
+MemoryTracker::ProcessSample MemoryTracker::sampleProcess() {
+#if defined(_WIN32)
+    // Windows does not split minor/major faults, PageFaultCount has both
+    PROCESS_MEMORY_COUNTERS counters{};
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return { 0, 0, 0 };
+    }
+    return { static_cast<uint64_t>(counters.PeakWorkingSetSize),
+             static_cast<uint64_t>(counters.WorkingSetSize),
+             static_cast<uint64_t>(counters.PageFaultCount) };
+#else
+    rusage usage{};
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return { 0, 0, 0 };
+    }
+    return { static_cast<uint64_t>(usage.ru_maxrss) * BYTES_PER_KB,
+             currentRssBytes(),
+             static_cast<uint64_t>(usage.ru_minflt) };
+#endif
+}
+
+#ifdef MERGE_MEMORY_TRACKING
+
+// Global operator new/delete hooks.
+// Each block gets a small header holding its size, so unsized delete
+// knows how many bytes go away. Plain operator new must return memory
+// aligned to __STDCPP_DEFAULT_NEW_ALIGNMENT__, which can be larger than
+// alignof(max_align_t) (16 vs. 8 on MSVC x64), so the header is sized to
+// the larger of the two. malloc already returns blocks aligned that much.
+
+namespace {
+#ifdef __STDCPP_DEFAULT_NEW_ALIGNMENT__
+	constexpr size_t HEADER_SIZE = std::max(alignof(std::max_align_t),
+											static_cast<size_t>(__STDCPP_DEFAULT_NEW_ALIGNMENT__));
+#else
+	constexpr size_t HEADER_SIZE = alignof(std::max_align_t);
+#endif
+
+	void* trackedAllocate(size_t bytes) {
+		void* raw = std::malloc(bytes + HEADER_SIZE);
+		if (!raw) {
+			return nullptr;
+		}
+		*static_cast<size_t*>(raw) = bytes;
+		MemoryTracker::recordAllocation(bytes);
+		return static_cast<char*>(raw) + HEADER_SIZE;
+	}
+
+	void trackedFree(void* ptr) {
+		if (!ptr) {
+			return;
+		}
+		void* raw = static_cast<char*>(ptr) - HEADER_SIZE;
+		MemoryTracker::recordDeallocation(*static_cast<size_t*>(raw));
+		std::free(raw);
+	}
+
+	void* trackedAllocateOrThrow(size_t bytes) {
+		void* ptr = trackedAllocate(bytes);
+		if (!ptr) {
+			throw std::bad_alloc();
+		}
+		return ptr;
+	}
+}
+
+void* operator new(size_t bytes) { return trackedAllocateOrThrow(bytes); }
+void* operator new[](size_t bytes) { return trackedAllocateOrThrow(bytes); }
+void* operator new(size_t bytes, const std::nothrow_t&) noexcept { return trackedAllocate(bytes); }
+void* operator new[](size_t bytes, const std::nothrow_t&) noexcept { return trackedAllocate(bytes); }
+
+void operator delete(void* ptr) noexcept { trackedFree(ptr); }
+void operator delete[](void* ptr) noexcept { trackedFree(ptr); }
+void operator delete(void* ptr, size_t) noexcept { trackedFree(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { trackedFree(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { trackedFree(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { trackedFree(ptr); }
+
+#endif // MERGE_MEMORY_TRACKING
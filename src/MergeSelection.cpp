@@ -0,0 +1,201 @@
+// MergeSelection.cpp
+// Co-rank search, k-th element selection and output range extraction
+
+#include "../include/MergeSelection.h"
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+namespace {
+	// Below this many output elements per thread, threads cost more than they save
+	constexpr size_t MIN_PARALLEL_ELEMENTS_PER_THREAD = 64 * 1024;
+
+	// Merge output positions [begin, end) of merge(a, b) into out
+	void mergeSlice(const std::vector<int>& a, const std::vector<int>& b,
+					size_t begin, size_t end, int* out) {
+		size_t i0 = MergeSelection::coRank(begin, a, b);
+		size_t i1 = MergeSelection::coRank(end, a, b);
+		size_t j0 = begin - i0;
+		size_t j1 = end - i1;
+		std::merge(a.begin() + i0, a.begin() + i1,
+				   b.begin() + j0, b.begin() + j1,
+				   out);
+	}
+
+	size_t totalSize(const std::vector<std::vector<int>>& runs) {
+		size_t total = 0;
+		for (const auto& run : runs) {
+			total += run.size();
+		}
+		return total;
+	}
+}
+
+size_t MergeSelection::coRank(size_t k, const std::vector<int>& a, const std::vector<int>& b) {
+    size_t n1 = a.size();
+    size_t n2 = b.size();
+    
+    // i elements from a, k - i from b; both counts must fit their inputs
+    size_t lo = (k > n2) ? k - n2 : 0;
+    size_t hi = std::min(k, n1);
+    
+    // Find the smallest i where a[i] is not needed before b[k - i - 1].
+    // a[i] <= b[k - i - 1] means a[i] is merged first, so more of a is needed.
+    while (lo < hi) {
+        size_t i = lo + (hi - lo) / 2;
+        size_t j = k - i;
+        if (a[i] <= b[j - 1]) {
+            lo = i + 1;
+        } else {
+            hi = i;
+        }
+    }
+    return lo;
+}
+
+int MergeSelection::selectKth(const std::vector<int>& a, const std::vector<int>& b, size_t k) {
+    if (k >= a.size() + b.size()) {
+        throw std::out_of_range("MergeSelection::selectKth: k is past the end of the merge");
+    }
+    
+    // The k-th element is the smaller of the next candidates after the co-rank split
+    size_t i = coRank(k, a, b);
+    size_t j = k - i;
+    if (i == a.size()) {
+        return b[j];
+    }
+    if (j == b.size()) {
+        return a[i];
+    }
+    return (b[j] < a[i]) ? b[j] : a[i];
+}
+
+std::vector<int> MergeSelection::mergeRange(const std::vector<int>& a, const std::vector<int>& b,
+                                            size_t begin, size_t end, int numThreads) {
+    end = std::min(end, a.size() + b.size());
+    if (begin >= end) {
+        return {};
+    }
+    
+    size_t count = end - begin;
+    std::vector<int> result(count);
+    
+    // Use fewer threads for small slices
+    size_t maxThreads = std::max<size_t>(1, count / MIN_PARALLEL_ELEMENTS_PER_THREAD);
+    size_t threadCount = std::min(static_cast<size_t>(std::max(numThreads, 1)), maxThreads);
+    
+    if (threadCount == 1) {
+        mergeSlice(a, b, begin, end, result.data());
+        return result;
+    }
+    
+    // Each thread finds its own co-ranks, so no partitioning step is needed
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < threadCount; ++t) {
+        size_t pieceBegin = begin + (count * t) / threadCount;
+        size_t pieceEnd = begin + (count * (t + 1)) / threadCount;
+        threads.emplace_back([&, pieceBegin, pieceEnd]() {
+            mergeSlice(a, b, pieceBegin, pieceEnd, result.data() + (pieceBegin - begin));
+        });
+    }
+    
+    for (auto& t : threads) {
+        t.join();
+    }
+    
+    return result;
+}
+
+int MergeSelection::selectKth(const std::vector<std::vector<int>>& runs, size_t k) {
+    if (k >= totalSize(runs)) {
+        throw std::out_of_range("MergeSelection::selectKth: k is past the end of the merge");
+    }
+    
+    // Find the smallest value v with more than k elements <= v
+    long long lo = std::numeric_limits<int>::max();
+    long long hi = std::numeric_limits<int>::min();
+    for (const auto& run : runs) {
+        if (!run.empty()) {
+            lo = std::min<long long>(lo, run.front());
+            hi = std::max<long long>(hi, run.back());
+        }
+    }
+    
+    while (lo < hi) {
+        long long mid = lo + (hi - lo) / 2;
+        size_t notGreater = 0;
+        for (const auto& run : runs) {
+            notGreater += std::upper_bound(run.begin(), run.end(), static_cast<int>(mid)) - run.begin();
+        }
+        if (notGreater > k) {
+            hi = mid;
+        } else {
+            lo = mid + 1;
+        }
+    }
+    return static_cast<int>(lo);
+}
+
+std::vector<size_t> MergeSelection::coRanks(const std::vector<std::vector<int>>& runs, size_t k) {
+    std::vector<size_t> positions(runs.size());
+    if (k >= totalSize(runs)) {
+        for (size_t r = 0; r < runs.size(); ++r) {
+            positions[r] = runs[r].size();
+        }
+        return positions;
+    }
+    
+    // Everything below the k-th value comes first, then equal values
+    // are taken run by run (earlier runs first, like a stable merge)
+    int value = selectKth(runs, k);
+    size_t taken = 0;
+    for (size_t r = 0; r < runs.size(); ++r) {
+        positions[r] = std::lower_bound(runs[r].begin(), runs[r].end(), value) - runs[r].begin();
+        taken += positions[r];
+    }
+    
+    size_t needed = k - taken;
+    for (size_t r = 0; r < runs.size() && needed > 0; ++r) {
+        size_t equal = std::upper_bound(runs[r].begin() + positions[r], runs[r].end(), value)
+                       - (runs[r].begin() + positions[r]);
+        size_t take = std::min(needed, equal);
+        positions[r] += take;
+        needed -= take;
+    }
+    return positions;
+}
+
+std::vector<int> MergeSelection::mergeRange(const std::vector<std::vector<int>>& runs,
+                                            size_t begin, size_t end) {
+    end = std::min(end, totalSize(runs));
+    if (begin >= end) {
+        return {};
+    }
+    
+    std::vector<size_t> positions = coRanks(runs, begin);
+    
+    // K-way merge from the start positions; ties go to the earlier run
+    using Entry = std::pair<int, size_t>;  // (value, run index)
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> heap;
+    for (size_t r = 0; r < runs.size(); ++r) {
+        if (positions[r] < runs[r].size()) {
+            heap.push({ runs[r][positions[r]], r });
+        }
+    }
+    
+    std::vector<int> result;
+    result.reserve(end - begin);
+    while (result.size() < end - begin) {
+        auto [value, r] = heap.top();
+        heap.pop();
+        result.push_back(value);
+        if (++positions[r] < runs[r].size()) {
+            heap.push({ runs[r][positions[r]], r });
+        }
+    }
+    return result;
+}
@@ -5,6 +5,7 @@
 #include <iostream>
 #include <iomanip>
 #include <string>
+#include <algorithm>
 
 namespace {
 	constexpr int SECTION_HEADER_WIDTH = 80;
@@ -13,8 +14,66 @@ namespace {
 	constexpr int TABLE_COL_TIME_WIDTH = 15;
 	constexpr int TABLE_COL_SPEEDUP_WIDTH = 15;
 	constexpr int TABLE_COL_RATIO_WIDTH = 22;
+	constexpr int STRATEGY_TABLE_SEPARATOR_WIDTH = 80;
+	constexpr int TABLE_COL_NAME_WIDTH = 36;
+	constexpr int TABLE_COL_THROUGHPUT_WIDTH = 14;
+	constexpr int SCALING_TABLE_SEPARATOR_WIDTH = 100;
+	constexpr int TABLE_COL_SIZE_WIDTH = 12;
+	constexpr int TABLE_COL_CAPACITY_WIDTH = 11;
+	constexpr int TABLE_COL_EFFICIENCY_WIDTH = 10;
+	// Efficiency bar: full width means 100% efficiency
+	constexpr int EFFICIENCY_BAR_WIDTH = 20;
+	constexpr double PERCENT = 100.0;
 	constexpr int PRECISION_TIME = 3;
 	constexpr int PRECISION_RATIO = 2;
+	constexpr int TABLE_COL_MEMORY_WIDTH = 11;
+	constexpr int MEMORY_COLUMN_COUNT = 6;
+	constexpr double BYTES_PER_MB = 1024.0 * 1024.0;
+	constexpr int PRECISION_MEMORY = 1;
+	constexpr int PRECISION_COUNT = 0;
+	constexpr int PRECISION_PERCENT = 1;
+	constexpr int INGEST_TABLE_SEPARATOR_WIDTH = 96;
+	constexpr int TABLE_COL_INGEST_NAME_WIDTH = 30;
+	constexpr int TABLE_COL_LATENCY_WIDTH = 13;
+
+	// Tables get wider when memory columns are printed
+	int tableWidth(int baseWidth) {
+		return MemoryTracker::isEnabled() ? baseWidth + TABLE_COL_MEMORY_WIDTH * MEMORY_COLUMN_COUNT : baseWidth;
+	}
+
+	void printMemoryHeaderColumns() {
+		if (!MemoryTracker::isEnabled()) {
+			return;
+		}
+		std::cout << std::setw(TABLE_COL_MEMORY_WIDTH) << "Allocs"
+				  << std::setw(TABLE_COL_MEMORY_WIDTH) << "Alloc MB"
+				  << std::setw(TABLE_COL_MEMORY_WIDTH) << "Peak MB"
+				  << std::setw(TABLE_COL_MEMORY_WIDTH) << "MaxRSS +MB"
+				  << std::setw(TABLE_COL_MEMORY_WIDTH) << "RSS MB"
+				  << std::setw(TABLE_COL_MEMORY_WIDTH) << "Min.Faults";
+	}
+
+	// One memory column, "n/a" if the value could not be measured
+	void printMemoryValue(double value, int precision) {
+		std::cout << std::setw(TABLE_COL_MEMORY_WIDTH);
+		if (MemoryTracker::isMeasured(value)) {
+			std::cout << std::fixed << std::setprecision(precision) << value;
+		} else {
+			std::cout << "n/a";
+		}
+	}
+
+	void printMemoryColumns(const MemoryStats& memory) {
+		if (!MemoryTracker::isEnabled()) {
+			return;
+		}
+		printMemoryValue(memory.allocations, PRECISION_MEMORY);
+		printMemoryValue(memory.bytesAllocated / BYTES_PER_MB, PRECISION_MEMORY);
+		printMemoryValue(memory.peakLiveBytes / BYTES_PER_MB, PRECISION_MEMORY);
+		printMemoryValue(memory.maxRssGrowthBytes / BYTES_PER_MB, PRECISION_MEMORY);
+		printMemoryValue(memory.currentRssBytes / BYTES_PER_MB, PRECISION_MEMORY);
+		printMemoryValue(memory.minorFaults, PRECISION_COUNT);
+	}
 }
 
 void OutputFormatter::printSectionHeader(const std::string& title) {
@@ -28,17 +87,106 @@ void OutputFormatter::printSubsectionHeader(const std::string& title) {
 }
 
 void OutputFormatter::printTableHeader() {
-    std::cout << std::string(TABLE_SEPARATOR_WIDTH, '-') << "\n";
+    std::cout << std::string(tableWidth(TABLE_SEPARATOR_WIDTH), '-') << "\n";
     std::cout << std::setw(TABLE_COL_K_WIDTH) << "K" 
               << std::setw(TABLE_COL_TIME_WIDTH) << "Time (ms)" 
               << std::setw(TABLE_COL_SPEEDUP_WIDTH) << "Speedup"
-              << std::setw(TABLE_COL_RATIO_WIDTH) << "K / CPU_threads\n";
-    std::cout << std::string(TABLE_SEPARATOR_WIDTH, '-') << "\n";
+              << std::setw(TABLE_COL_RATIO_WIDTH) << "K / CPU_threads";
+    printMemoryHeaderColumns();
+    std::cout << "\n";
+    std::cout << std::string(tableWidth(TABLE_SEPARATOR_WIDTH), '-') << "\n";
 }
 
-void OutputFormatter::printTableRow(int K, double time, double speedup, double ratio) {
+void OutputFormatter::printTableRow(int K, double time, double speedup, double ratio,
+                                    const MemoryStats& memory) {
     std::cout << std::setw(TABLE_COL_K_WIDTH) << K
               << std::setw(TABLE_COL_TIME_WIDTH) << std::fixed << std::setprecision(PRECISION_TIME) << time
               << std::setw(TABLE_COL_SPEEDUP_WIDTH) << std::fixed << std::setprecision(PRECISION_RATIO) << speedup << "x"
-              << std::setw(TABLE_COL_RATIO_WIDTH) << std::fixed << std::setprecision(PRECISION_RATIO) << ratio << "\n";
+              << std::setw(TABLE_COL_RATIO_WIDTH) << std::fixed << std::setprecision(PRECISION_RATIO) << ratio;
+    printMemoryColumns(memory);
+    std::cout << "\n";
+}
+
+void OutputFormatter::printStrategyTableHeader() {
+    std::cout << std::string(tableWidth(STRATEGY_TABLE_SEPARATOR_WIDTH), '-') << "\n";
+    std::cout << std::left << std::setw(TABLE_COL_NAME_WIDTH) << "Strategy" << std::right
+              << std::setw(TABLE_COL_TIME_WIDTH) << "Time (ms)" 
+              << std::setw(TABLE_COL_SPEEDUP_WIDTH) << "Speedup"
+              << std::setw(TABLE_COL_THROUGHPUT_WIDTH) << "GB/s";
+    printMemoryHeaderColumns();
+    std::cout << "\n";
+    std::cout << std::string(tableWidth(STRATEGY_TABLE_SEPARATOR_WIDTH), '-') << "\n";
+}
+
+void OutputFormatter::printStrategyTableRow(const std::string& name, double time, 
+                                            double speedup, double throughput,
+                                            const MemoryStats& memory) {
+    std::cout << std::left << std::setw(TABLE_COL_NAME_WIDTH) << name << std::right
+              << std::setw(TABLE_COL_TIME_WIDTH) << std::fixed << std::setprecision(PRECISION_TIME) << time
+              << std::setw(TABLE_COL_SPEEDUP_WIDTH) << std::fixed << std::setprecision(PRECISION_RATIO) << speedup << "x"
+              << std::setw(TABLE_COL_THROUGHPUT_WIDTH - 1) << std::fixed << std::setprecision(PRECISION_RATIO) << throughput;
+    printMemoryColumns(memory);
+    std::cout << "\n";
+}
+
+void OutputFormatter::printScalingTableHeader() {
+    std::cout << std::string(tableWidth(SCALING_TABLE_SEPARATOR_WIDTH), '-') << "\n";
+    std::cout << std::setw(TABLE_COL_K_WIDTH) << "Threads"
+              << std::setw(TABLE_COL_SIZE_WIDTH) << "Size"
+              << std::setw(TABLE_COL_TIME_WIDTH) << "Time (ms)"
+              << std::setw(TABLE_COL_CAPACITY_WIDTH) << "Capacity"
+              << std::setw(TABLE_COL_CAPACITY_WIDTH) << "Amdahl"
+              << std::setw(TABLE_COL_CAPACITY_WIDTH) << "USL"
+              << std::setw(TABLE_COL_EFFICIENCY_WIDTH) << "Eff."
+              << "  " << std::left << std::setw(EFFICIENCY_BAR_WIDTH + 2) << "Efficiency curve" << std::right;
+    printMemoryHeaderColumns();
+    std::cout << "\n";
+    std::cout << std::string(tableWidth(SCALING_TABLE_SEPARATOR_WIDTH), '-') << "\n";
+}
+
+void OutputFormatter::printScalingTableRow(int threads, size_t size, double time, double capacity,
+                                           double amdahl, double usl,
+                                           const MemoryStats& memory) {
+    double efficiency = capacity / threads;
+    int barLength = static_cast<int>(std::clamp(efficiency, 0.0, 1.0) * EFFICIENCY_BAR_WIDTH + 0.5);
+    
+    std::cout << std::setw(TABLE_COL_K_WIDTH) << threads
+              << std::setw(TABLE_COL_SIZE_WIDTH) << size
+              << std::setw(TABLE_COL_TIME_WIDTH) << std::fixed << std::setprecision(PRECISION_TIME) << time
+              << std::setw(TABLE_COL_CAPACITY_WIDTH) << std::fixed << std::setprecision(PRECISION_RATIO) << capacity
+              << std::setw(TABLE_COL_CAPACITY_WIDTH) << amdahl
+              << std::setw(TABLE_COL_CAPACITY_WIDTH) << usl
+              << std::setw(TABLE_COL_EFFICIENCY_WIDTH - 1) << std::setprecision(PRECISION_PERCENT) << efficiency * PERCENT << "%"
+              << "  |" << std::string(barLength, '#') << std::string(EFFICIENCY_BAR_WIDTH - barLength, ' ') << "|";
+    printMemoryColumns(memory);
+    std::cout << "\n";
+}
+
+void OutputFormatter::printIngestTableHeader() {
+    std::cout << std::string(INGEST_TABLE_SEPARATOR_WIDTH, '-') << "\n";
+    std::cout << std::left << std::setw(TABLE_COL_INGEST_NAME_WIDTH) << "Approach" << std::right
+              << std::setw(TABLE_COL_LATENCY_WIDTH) << "Ingest"
+              << std::setw(TABLE_COL_LATENCY_WIDTH) << "Lookup avg"
+              << std::setw(TABLE_COL_LATENCY_WIDTH) << "Lookup p99"
+              << std::setw(TABLE_COL_LATENCY_WIDTH) << "Scan avg"
+              << std::setw(TABLE_COL_LATENCY_WIDTH) << "Scan p99" << "\n";
+    std::cout << std::left << std::setw(TABLE_COL_INGEST_NAME_WIDTH) << "" << std::right
+              << std::setw(TABLE_COL_LATENCY_WIDTH) << "(M elem/s)"
+              << std::setw(TABLE_COL_LATENCY_WIDTH) << "(us)"
+              << std::setw(TABLE_COL_LATENCY_WIDTH) << "(us)"
+              << std::setw(TABLE_COL_LATENCY_WIDTH) << "(us)"
+              << std::setw(TABLE_COL_LATENCY_WIDTH) << "(us)" << "\n";
+    std::cout << std::string(INGEST_TABLE_SEPARATOR_WIDTH, '-') << "\n";
+}
+
+void OutputFormatter::printIngestTableRow(const std::string& name, double ingestRate,
+                                          double lookupAvg, double lookupP99,
+                                          double scanAvg, double scanP99) {
+    std::cout << std::left << std::setw(TABLE_COL_INGEST_NAME_WIDTH) << name << std::right
+              << std::fixed << std::setprecision(PRECISION_RATIO)
+              << std::setw(TABLE_COL_LATENCY_WIDTH) << ingestRate
+              << std::setw(TABLE_COL_LATENCY_WIDTH) << lookupAvg
+              << std::setw(TABLE_COL_LATENCY_WIDTH) << lookupP99
+              << std::setw(TABLE_COL_LATENCY_WIDTH) << scanAvg
+              << std::setw(TABLE_COL_LATENCY_WIDTH) << scanP99 << "\n";
 }
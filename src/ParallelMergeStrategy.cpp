@@ -3,6 +3,7 @@
 
 #include "../include/ParallelMergeStrategy.h"
 #include "../include/SequentialMergeStrategy.h"
+#include "../include/PhaseTracer.h"
 #include <algorithm>
 #include <thread>
 #include <iterator>
@@ -14,6 +15,7 @@ std::vector<int> ParallelMergeStrategy::merge(const std::vector<int>& vec1,
                                                const std::vector<int>& vec2) {
     if (numThreads_ == 1) {
         // Just use sequential merge if K=1
+        TRACE_SCOPE("sequential merge");
         return SequentialMergeStrategy().merge(vec1, vec2);
     }
     
@@ -24,42 +26,44 @@ std::vector<int> ParallelMergeStrategy::merge(const std::vector<int>& vec1,
     std::vector<std::vector<int>> partialResults(numThreads_);
     std::vector<std::thread> threads;
     
+    TRACE_TIMESTAMP(spawnBegin);
+    
     // Create K threads, each handling one part
     for (int i = 0; i < numThreads_; ++i) {
         threads.emplace_back([&, i]() {
-            // Figure out which part of vec1 this thread handles
-            size_t start1 = (n1 * i) / numThreads_;
-            size_t end1 = (n1 * (i + 1)) / numThreads_;
-            
-            // Find the corresponding split in vec2 using binary search
-            size_t start2, end2;
+            TRACE_TIMESTAMP(workerStart);
+            TRACE_RECORD("thread start", spawnBegin, workerStart);
             
-            if (start1 < n1) {
-                start2 = std::lower_bound(vec2.begin(), vec2.end(), vec1[start1]) - vec2.begin();
-            } else {
-                start2 = n2;
-            }
+            // Figure out which parts of vec1 and vec2 this thread handles
+            MergePartition part = computePartition(vec1.data(), n1, vec2.data(), n2, i, numThreads_);
             
-            if (end1 < n1) {
-                end2 = std::lower_bound(vec2.begin(), vec2.end(), vec1[end1]) - vec2.begin();
-            } else {
-                end2 = n2;
-            }
+            TRACE_TIMESTAMP(partitionEnd);
+            TRACE_RECORD("partition", workerStart, partitionEnd);
             
             // Merge these two ranges
-            size_t resultSize = (end1 - start1) + (end2 - start2);
+            size_t resultSize = (part.end1 - part.start1) + (part.end2 - part.start2);
             partialResults[i].resize(resultSize);
             
-            std::merge(vec1.begin() + start1, vec1.begin() + end1,
-                      vec2.begin() + start2, vec2.begin() + end2,
+            TRACE_TIMESTAMP(allocateEnd);
+            TRACE_RECORD("allocate", partitionEnd, allocateEnd);
+            
+            std::merge(vec1.begin() + part.start1, vec1.begin() + part.end1,
+                      vec2.begin() + part.start2, vec2.begin() + part.end2,
                       partialResults[i].begin());
+            
+            TRACE_TIMESTAMP(mergeEnd);
+            TRACE_RECORD("merge", allocateEnd, mergeEnd);
         });
     }
     
     // Wait for all threads to finish
+    TRACE_TIMESTAMP(joinBegin);
+    TRACE_RECORD("spawn", spawnBegin, joinBegin);
     for (auto& t : threads) {
         t.join();
     }
+    TRACE_TIMESTAMP(joinEnd);
+    TRACE_RECORD("join wait", joinBegin, joinEnd);
     
     // Put all partial results together (they're already sorted relative to each other)
     size_t totalSize = 0;
@@ -74,6 +78,9 @@ std::vector<int> ParallelMergeStrategy::merge(const std::vector<int>& vec1,
         result.insert(result.end(), partial.begin(), partial.end());
     }
     
+    TRACE_TIMESTAMP(concatEnd);
+    TRACE_RECORD("concatenate", joinEnd, concatEnd);
+    
     return result;
 }
 
@@ -84,3 +91,31 @@ std::string ParallelMergeStrategy::getName() const {
 int ParallelMergeStrategy::getThreadCount() const {
     return numThreads_;
 }
+
+MergePartition ParallelMergeStrategy::computePartition(const int* vec1, size_t n1,
+                                                       const int* vec2, size_t n2,
+                                                       int part, int numParts) {
+    MergePartition result;
+    
+    // Figure out which part of vec1 this is
+    result.start1 = (n1 * part) / numParts;
+    result.end1 = (n1 * (part + 1)) / numParts;
+    
+    // Find the corresponding split in vec2 using binary search
+    if (part == 0) {
+        // First part also takes everything in vec2 below vec1[0]
+        result.start2 = 0;
+    } else if (result.start1 < n1) {
+        result.start2 = std::lower_bound(vec2, vec2 + n2, vec1[result.start1]) - vec2;
+    } else {
+        result.start2 = n2;
+    }
+    
+    if (result.end1 < n1) {
+        result.end2 = std::lower_bound(vec2, vec2 + n2, vec1[result.end1]) - vec2;
+    } else {
+        result.end2 = n2;
+    }
+    
+    return result;
+}
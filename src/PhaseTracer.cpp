@@ -0,0 +1,129 @@
+// PhaseTracer.cpp
+// Lock-free per-lane event buffers and Chrome trace export
+
+#include "../include/PhaseTracer.h"
+#include <fstream>
+#include <iomanip>
+
+namespace {
+	// Max events per lane, extra events are counted as dropped
+	constexpr size_t LANE_CAPACITY = 1 << 16;
+	constexpr double NS_PER_US = 1000.0;
+	// Chrome trace timestamps are in microseconds, keep nanosecond digits
+	constexpr int TIMESTAMP_PRECISION = 3;
+	constexpr int TRACE_PROCESS_ID = 1;
+}
+
+PhaseTracer::PhaseTracer() : epoch_(Clock::now()) {}
+
+PhaseTracer& PhaseTracer::instance() {
+    static PhaseTracer tracer;
+    return tracer;
+}
+
+int64_t PhaseTracer::now() const {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - epoch_).count();
+}
+
+PhaseTracer::Lane& PhaseTracer::currentLane() {
+    thread_local LaneOwner owner;
+    if (!owner.lane) {
+        owner.lane = acquireLane();
+    }
+    return *owner.lane;
+}
+
+PhaseTracer::Lane* PhaseTracer::acquireLane() {
+    std::lock_guard<std::mutex> lock(lanesMutex_);
+    if (!freeLanes_.empty()) {
+        Lane* lane = freeLanes_.back();
+        freeLanes_.pop_back();
+        return lane;
+    }
+    
+    auto lane = std::make_unique<Lane>();
+    lane->events = std::make_unique<Event[]>(LANE_CAPACITY);
+    lanes_.push_back(std::move(lane));
+    return lanes_.back().get();
+}
+
+void PhaseTracer::releaseLane(Lane* lane) {
+    std::lock_guard<std::mutex> lock(lanesMutex_);
+    freeLanes_.push_back(lane);
+}
+
+PhaseTracer::LaneOwner::~LaneOwner() {
+    if (lane) {
+        PhaseTracer::instance().releaseLane(lane);
+    }
+}
+
+void PhaseTracer::record(const char* name, int64_t startNs, int64_t endNs) {
+    Lane& target = currentLane();
+    // Only the owning thread writes this lane, so a relaxed load is enough
+    size_t index = target.size.load(std::memory_order_relaxed);
+    if (index >= LANE_CAPACITY) {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    
+    target.events[index] = Event{ name, startNs, endNs };
+    // Publish the event for the exporter
+    target.size.store(index + 1, std::memory_order_release);
+}
+
+void PhaseTracer::clear() {
+    std::lock_guard<std::mutex> lock(lanesMutex_);
+    for (auto& lane : lanes_) {
+        lane->size.store(0, std::memory_order_relaxed);
+    }
+    dropped_.store(0, std::memory_order_relaxed);
+}
+
+uint64_t PhaseTracer::getDroppedCount() const {
+    return dropped_.load(std::memory_order_relaxed);
+}
+
+bool PhaseTracer::exportChromeTrace(const std::string& path) const {
+    std::ofstream out(path);
+    if (!out) {
+        return false;
+    }
+    
+    std::lock_guard<std::mutex> lock(lanesMutex_);
+    out << std::fixed << std::setprecision(TIMESTAMP_PRECISION);
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    bool first = true;
+    
+    for (size_t laneIndex = 0; laneIndex < lanes_.size(); ++laneIndex) {
+        // Name the lane so the viewer shows "thread N". A lane holds the events
+        // of every thread that used it, one after another.
+        const Lane& lane = *lanes_[laneIndex];
+        if (!first) {
+            out << ",\n";
+        }
+        first = false;
+        out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << TRACE_PROCESS_ID
+            << ",\"tid\":" << laneIndex << ",\"args\":{\"name\":\"thread " << laneIndex << "\"}}";
+        
+        size_t count = lane.size.load(std::memory_order_acquire);
+        for (size_t i = 0; i < count; ++i) {
+            const Event& event = lane.events[i];
+            out << ",\n{\"name\":\"" << event.name << "\",\"cat\":\"merge\",\"ph\":\"X\""
+                << ",\"pid\":" << TRACE_PROCESS_ID << ",\"tid\":" << laneIndex
+                << ",\"ts\":" << event.startNs / NS_PER_US
+                << ",\"dur\":" << (event.endNs - event.startNs) / NS_PER_US << "}";
+        }
+    }
+    
+    out << "\n]}\n";
+    return static_cast<bool>(out);
+}
+
+PhaseTracer::Scope::Scope(const char* name)
+    : name_(name), start_(PhaseTracer::instance().now()) {}
+
+PhaseTracer::Scope::~Scope() {
+    PhaseTracer& tracer = PhaseTracer::instance();
+    tracer.record(name_, start_, tracer.now());
+}
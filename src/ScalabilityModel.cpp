@@ -0,0 +1,118 @@
+// ScalabilityModel.cpp
+// Linearized least-squares fits for Amdahl and USL
+
+#include "../include/ScalabilityModel.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace {
+	// Guard against division by (almost) zero in the normal equations
+	constexpr double EPSILON = 1e-12;
+
+	// Coefficient of determination of a model against the measured points
+	template<typename Model>
+	double computeRSquared(const Model& model, const std::vector<ScalingPoint>& points) {
+		if (points.empty()) {
+			return 0.0;
+		}
+
+		double mean = 0.0;
+		for (const auto& p : points) {
+			mean += p.capacity;
+		}
+		mean /= points.size();
+
+		double residual = 0.0;
+		double total = 0.0;
+		for (const auto& p : points) {
+			double diff = p.capacity - model.predict(p.threads);
+			residual += diff * diff;
+			total += (p.capacity - mean) * (p.capacity - mean);
+		}
+		return (total > EPSILON) ? 1.0 - residual / total : 1.0;
+	}
+}
+
+double AmdahlFit::predict(int threads) const {
+    double n = static_cast<double>(threads);
+    return 1.0 / (serialFraction + (1.0 - serialFraction) / n);
+}
+
+double AmdahlFit::maxSpeedup() const {
+    return (serialFraction > EPSILON) ? 1.0 / serialFraction : std::numeric_limits<double>::infinity();
+}
+
+double UslFit::predict(int threads) const {
+    double n = static_cast<double>(threads);
+    return n / (1.0 + sigma * (n - 1.0) + kappa * n * (n - 1.0));
+}
+
+double UslFit::peakThreads() const {
+    if (kappa <= EPSILON) {
+        return 0.0;
+    }
+    return std::sqrt((1.0 - sigma) / kappa);
+}
+
+AmdahlFit ScalabilityModel::fitAmdahl(const std::vector<ScalingPoint>& points) {
+    // 1/C - 1/N = s * (1 - 1/N), a line through the origin in x = 1 - 1/N
+    double sumXY = 0.0;
+    double sumXX = 0.0;
+    for (const auto& p : points) {
+        if (p.capacity <= 0.0) {
+            continue;
+        }
+        double invN = 1.0 / p.threads;
+        double x = 1.0 - invN;
+        double y = 1.0 / p.capacity - invN;
+        sumXY += x * y;
+        sumXX += x * x;
+    }
+    
+    AmdahlFit fit{};
+    fit.serialFraction = (sumXX > EPSILON) ? std::clamp(sumXY / sumXX, 0.0, 1.0) : 0.0;
+    fit.rSquared = computeRSquared(fit, points);
+    return fit;
+}
+
+UslFit ScalabilityModel::fitUsl(const std::vector<ScalingPoint>& points) {
+    // N/C - 1 = sigma * (N - 1) + kappa * N * (N - 1), two-variable regression without intercept
+    double s11 = 0.0, s12 = 0.0, s22 = 0.0, s1y = 0.0, s2y = 0.0;
+    for (const auto& p : points) {
+        if (p.capacity <= 0.0) {
+            continue;
+        }
+        double n = static_cast<double>(p.threads);
+        double x1 = n - 1.0;
+        double x2 = n * (n - 1.0);
+        double y = n / p.capacity - 1.0;
+        s11 += x1 * x1;
+        s12 += x1 * x2;
+        s22 += x2 * x2;
+        s1y += x1 * y;
+        s2y += x2 * y;
+    }
+    
+    UslFit fit{};
+    double det = s11 * s22 - s12 * s12;
+    if (std::abs(det) > EPSILON) {
+        fit.sigma = (s1y * s22 - s2y * s12) / det;
+        fit.kappa = (s2y * s11 - s1y * s12) / det;
+    }
+    
+    // Coefficients are physically non-negative; if one goes negative, refit the other alone
+    if (fit.kappa < 0.0 || std::abs(det) <= EPSILON) {
+        fit.kappa = 0.0;
+        fit.sigma = (s11 > EPSILON) ? s1y / s11 : 0.0;
+    }
+    if (fit.sigma < 0.0) {
+        fit.sigma = 0.0;
+        fit.kappa = (s22 > EPSILON) ? std::max(s2y / s22, 0.0) : 0.0;
+    }
+    // sigma = 1 already means no gain from extra threads
+    fit.sigma = std::min(fit.sigma, 1.0);
+    
+    fit.rSquared = computeRSquared(fit, points);
+    return fit;
+}
@@ -0,0 +1,483 @@
+// SharedMemoryMergeStrategy.cpp
+// Multi-process merge: named shm segments, a pool of forked workers, futex signalling
+
+#include "../include/SharedMemoryMergeStrategy.h"
+#include "../include/ParallelMergeStrategy.h"
+#include "../include/MemoryTracker.h"
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+#include <cerrno>
+#include <ctime>
+#include <fcntl.h>
+#include <csignal>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#define MERGE_HAS_SHARED_MEMORY_WORKERS 1
+#endif
+
+namespace {
+	constexpr size_t CACHE_LINE_BYTES = 64;
+	// How often the coordinator wakes up to check for dead workers,
+	// and idle workers wake up to check the coordinator is still there
+	constexpr long WORKER_CHECK_INTERVAL_NS = 100'000'000;
+	// Room for "/merge_segment_<pid>_<counter>" and the terminating zero
+	constexpr size_t SEGMENT_NAME_CAPACITY = 64;
+
+#if defined(MERGE_HAS_SHARED_MEMORY_WORKERS)
+	size_t alignUp(size_t value, size_t alignment) {
+		return (value + alignment - 1) / alignment * alignment;
+	}
+
+	static_assert(std::atomic<uint32_t>::is_always_lock_free,
+				  "futex word must be a lock-free 32-bit atomic");
+
+	uint32_t* futexWord(std::atomic<uint32_t>& value) {
+		return reinterpret_cast<uint32_t*>(&value);
+	}
+
+	// Not FUTEX_PRIVATE: waiter and waker are different processes
+	void futexWait(std::atomic<uint32_t>& value, uint32_t expected, const timespec* timeout) {
+		syscall(SYS_futex, futexWord(value), FUTEX_WAIT, expected, timeout, nullptr, 0);
+	}
+
+	void futexWake(std::atomic<uint32_t>& value, int waiters) {
+		syscall(SYS_futex, futexWord(value), FUTEX_WAKE, waiters, nullptr, nullptr, 0);
+	}
+
+	// Unique name per segment, so a worker can tell a new job's segment from the one it has mapped
+	std::string makeSegmentName() {
+		static std::atomic<unsigned int> counter{0};
+		return "/merge_segment_" + std::to_string(getpid()) + "_" + std::to_string(counter++);
+	}
+#endif
+}
+
+struct SharedMergeSegment::Header {
+    uint64_t mappedBytes;
+    uint64_t size1;
+    uint64_t size2;
+    uint64_t partitionsOffset;
+    uint64_t input1Offset;
+    uint64_t input2Offset;
+    uint64_t outputOffset;
+    uint32_t workerCount;
+};
+
+struct SharedMergeSegment::Partition {
+    uint64_t start1;
+    uint64_t end1;
+    uint64_t start2;
+    uint64_t end2;
+};
+
+struct MergeWorkerPool::ControlBlock {
+    // Futex words. Must be plain 32-bit values.
+    std::atomic<uint32_t> jobSequence;  // bumped once per job (and on shutdown)
+    std::atomic<uint32_t> remaining;    // workers still busy with the current job
+    std::atomic<uint32_t> failedWorkers;
+    std::atomic<uint32_t> shutdown;
+    uint32_t workerCount;
+    // Segment of the current job, written before jobSequence is bumped
+    char segmentName[SEGMENT_NAME_CAPACITY];
+};
+
+SharedMergeSegment::SharedMergeSegment(size_t size1, size_t size2, int numWorkers) {
+#if defined(MERGE_HAS_SHARED_MEMORY_WORKERS)
+    uint32_t workers = static_cast<uint32_t>(numWorkers > 0 ? numWorkers : 1);
+    
+    // Layout: header | partitions | input1 | input2 | output,
+    // each part starts on its own cache line
+    size_t partitionsOffset = alignUp(sizeof(Header), CACHE_LINE_BYTES);
+    size_t input1Offset = alignUp(partitionsOffset + workers * sizeof(Partition), CACHE_LINE_BYTES);
+    size_t input2Offset = alignUp(input1Offset + size1 * sizeof(int), CACHE_LINE_BYTES);
+    size_t outputOffset = alignUp(input2Offset + size2 * sizeof(int), CACHE_LINE_BYTES);
+    mappedBytes_ = outputOffset + (size1 + size2) * sizeof(int);
+    
+    name_ = makeSegmentName();
+    int fd = shm_open(name_.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+    if (fd < 0) {
+        throw std::runtime_error("shm_open failed: " + std::string(std::strerror(errno)));
+    }
+    
+    if (ftruncate(fd, static_cast<off_t>(mappedBytes_)) != 0) {
+        int error = errno;
+        close(fd);
+        shm_unlink(name_.c_str());
+        throw std::runtime_error("ftruncate failed: " + std::string(std::strerror(error)));
+    }
+    
+    base_ = mmap(nullptr, mappedBytes_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    int mapError = errno;
+    close(fd);
+    if (base_ == MAP_FAILED) {
+        shm_unlink(name_.c_str());
+        throw std::runtime_error("mmap failed: " + std::string(std::strerror(mapError)));
+    }
+    
+    // Not an operator new allocation, so report it to the tracker ourselves
+    if (MemoryTracker::isEnabled()) {
+        MemoryTracker::recordAllocation(mappedBytes_);
+    }
+    
+    char* bytes = static_cast<char*>(base_);
+    header_ = new (bytes) Header{};
+    header_->mappedBytes = mappedBytes_;
+    header_->size1 = size1;
+    header_->size2 = size2;
+    header_->partitionsOffset = partitionsOffset;
+    header_->input1Offset = input1Offset;
+    header_->input2Offset = input2Offset;
+    header_->outputOffset = outputOffset;
+    header_->workerCount = workers;
+    partitions_ = reinterpret_cast<Partition*>(bytes + partitionsOffset);
+    input1_ = reinterpret_cast<int*>(bytes + input1Offset);
+    input2_ = reinterpret_cast<int*>(bytes + input2Offset);
+    output_ = reinterpret_cast<int*>(bytes + outputOffset);
+#else
+    (void)size1;
+    (void)size2;
+    (void)numWorkers;
+    throw std::runtime_error("Shared memory merge workers are only supported on Linux");
+#endif
+}
+
+SharedMergeSegment::~SharedMergeSegment() {
+#if defined(MERGE_HAS_SHARED_MEMORY_WORKERS)
+    munmap(base_, mappedBytes_);
+    if (MemoryTracker::isEnabled()) {
+        MemoryTracker::recordDeallocation(mappedBytes_);
+    }
+    // Workers that still have it mapped keep the memory until they drop it
+    shm_unlink(name_.c_str());
+#endif
+}
+
+int* SharedMergeSegment::input1() {
+    return input1_;
+}
+
+int* SharedMergeSegment::input2() {
+    return input2_;
+}
+
+const int* SharedMergeSegment::output() const {
+    return output_;
+}
+
+size_t SharedMergeSegment::size1() const {
+    return static_cast<size_t>(header_->size1);
+}
+
+size_t SharedMergeSegment::size2() const {
+    return static_cast<size_t>(header_->size2);
+}
+
+int SharedMergeSegment::getWorkerCount() const {
+    return static_cast<int>(header_->workerCount);
+}
+
+const std::string& SharedMergeSegment::getName() const {
+    return name_;
+}
+
+void SharedMergeSegment::partition() {
+    size_t n1 = size1();
+    size_t n2 = size2();
+    int workers = getWorkerCount();
+    
+    // Same split as ParallelMergeStrategy, but done once by the coordinator
+    for (int i = 0; i < workers; ++i) {
+        MergePartition part = ParallelMergeStrategy::computePartition(input1_, n1, input2_, n2, i, workers);
+        partitions_[i] = Partition{ part.start1, part.end1, part.start2, part.end2 };
+    }
+}
+
+bool SharedMergeSegment::mergeSlice(void* base, size_t mappedBytes, int worker) {
+    char* bytes = static_cast<char*>(base);
+    if (mappedBytes < sizeof(Header)) {
+        return false;
+    }
+    const Header* header = reinterpret_cast<const Header*>(bytes);
+    if (header->mappedBytes != mappedBytes || worker < 0
+        || static_cast<uint32_t>(worker) >= header->workerCount) {
+        return false;
+    }
+    
+    const Partition& part = reinterpret_cast<const Partition*>(bytes + header->partitionsOffset)[worker];
+    const int* input1 = reinterpret_cast<const int*>(bytes + header->input1Offset);
+    const int* input2 = reinterpret_cast<const int*>(bytes + header->input2Offset);
+    int* output = reinterpret_cast<int*>(bytes + header->outputOffset);
+    std::merge(input1 + part.start1, input1 + part.end1,
+               input2 + part.start2, input2 + part.end2,
+               output + part.start1 + part.start2);
+    return true;
+}
+
+#if defined(MERGE_HAS_SHARED_MEMORY_WORKERS)
+namespace {
+	// The segment a worker has mapped. Kept between jobs, so repeated merges
+	// of the same segment don't fault its pages in again.
+	struct WorkerMapping {
+		char name[SEGMENT_NAME_CAPACITY];
+		void* base;
+		size_t bytes;
+	};
+
+	void unmapSegment(WorkerMapping& mapping) {
+		if (mapping.base) {
+			munmap(mapping.base, mapping.bytes);
+			mapping.base = nullptr;
+			mapping.bytes = 0;
+			mapping.name[0] = '\0';
+		}
+	}
+
+	bool mapSegment(WorkerMapping& mapping, const char* name) {
+		if (mapping.base && std::strncmp(mapping.name, name, SEGMENT_NAME_CAPACITY) == 0) {
+			return true;
+		}
+		unmapSegment(mapping);
+
+		int fd = shm_open(name, O_RDWR, 0);
+		if (fd < 0) {
+			return false;
+		}
+		struct stat info{};
+		if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+			close(fd);
+			return false;
+		}
+		size_t bytes = static_cast<size_t>(info.st_size);
+		void* base = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+		close(fd);
+		if (base == MAP_FAILED) {
+			return false;
+		}
+
+		std::strncpy(mapping.name, name, SEGMENT_NAME_CAPACITY - 1);
+		mapping.name[SEGMENT_NAME_CAPACITY - 1] = '\0';
+		mapping.base = base;
+		mapping.bytes = bytes;
+		return true;
+	}
+}
+#endif
+
+MergeWorkerPool::MergeWorkerPool(int numWorkers)
+    : control_(nullptr), stopped_(false) {
+#if defined(MERGE_HAS_SHARED_MEMORY_WORKERS)
+    uint32_t workers = static_cast<uint32_t>(numWorkers > 0 ? numWorkers : 1);
+    
+    // Anonymous shared mapping: every worker forked below inherits it
+    void* control = mmap(nullptr, sizeof(ControlBlock), PROT_READ | PROT_WRITE,
+                         MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (control == MAP_FAILED) {
+        throw std::runtime_error("mmap failed: " + std::string(std::strerror(errno)));
+    }
+    control_ = new (control) ControlBlock{};
+    control_->workerCount = workers;
+    
+    pid_t parent = getpid();
+    workerPids_.reserve(workers);
+    for (uint32_t i = 0; i < workers; ++i) {
+        pid_t pid = fork();
+        
+        if (pid == 0) {
+            // Worker process: sleep until the job counter moves, merge our slice, report back.
+            // No allocation here, the parent may have had other threads at fork time.
+            WorkerMapping mapping{};
+            timespec interval{ 0, WORKER_CHECK_INTERVAL_NS };
+            uint32_t seen = 0;
+            for (;;) {
+                uint32_t sequence = control_->jobSequence.load(std::memory_order_acquire);
+                if (sequence == seen) {
+                    // Don't outlive a coordinator that died without stopping the pool
+                    if (getppid() != parent) {
+                        _exit(1);
+                    }
+                    futexWait(control_->jobSequence, seen, &interval);
+                    continue;
+                }
+                seen = sequence;
+                if (control_->shutdown.load(std::memory_order_acquire) != 0) {
+                    unmapSegment(mapping);
+                    _exit(0);
+                }
+                
+                bool merged = mapSegment(mapping, control_->segmentName)
+                    && SharedMergeSegment::mergeSlice(mapping.base, mapping.bytes, static_cast<int>(i));
+                if (!merged) {
+                    control_->failedWorkers.fetch_add(1, std::memory_order_relaxed);
+                }
+                control_->remaining.fetch_sub(1, std::memory_order_acq_rel);
+                futexWake(control_->remaining, 1);
+            }
+        }
+        
+        if (pid < 0) {
+            int error = errno;
+            stop(true);
+            throw std::runtime_error("fork failed: " + std::string(std::strerror(error)));
+        }
+        workerPids_.push_back(pid);
+    }
+#else
+    (void)numWorkers;
+    throw std::runtime_error("Shared memory merge workers are only supported on Linux");
+#endif
+}
+
+MergeWorkerPool::~MergeWorkerPool() {
+#if defined(MERGE_HAS_SHARED_MEMORY_WORKERS)
+    stop(false);
+#endif
+}
+
+void MergeWorkerPool::stop(bool force) {
+#if defined(MERGE_HAS_SHARED_MEMORY_WORKERS)
+    if (stopped_) {
+        return;
+    }
+    stopped_ = true;
+    
+    control_->shutdown.store(1, std::memory_order_release);
+    control_->jobSequence.fetch_add(1, std::memory_order_acq_rel);
+    futexWake(control_->jobSequence, INT_MAX);
+    
+    for (int pid : workerPids_) {
+        if (pid <= 0) {
+            continue;  // already reaped
+        }
+        if (force) {
+            kill(pid, SIGKILL);
+        }
+        int status = 0;
+        waitpid(pid, &status, 0);
+    }
+    workerPids_.clear();
+    
+    control_->~ControlBlock();
+    munmap(control_, sizeof(ControlBlock));
+    control_ = nullptr;
+#else
+    (void)force;
+#endif
+}
+
+int MergeWorkerPool::getWorkerCount() const {
+    return control_ ? static_cast<int>(control_->workerCount) : 0;
+}
+
+void MergeWorkerPool::run(SharedMergeSegment& segment) {
+#if defined(MERGE_HAS_SHARED_MEMORY_WORKERS)
+    if (stopped_) {
+        throw std::runtime_error("Merge worker pool has stopped after a worker failure");
+    }
+    uint32_t workers = control_->workerCount;
+    if (segment.getWorkerCount() != static_cast<int>(workers)) {
+        throw std::invalid_argument("Segment is split for " + std::to_string(segment.getWorkerCount())
+                                    + " workers, the pool has " + std::to_string(workers));
+    }
+    const std::string& name = segment.getName();
+    if (name.size() >= SEGMENT_NAME_CAPACITY) {
+        throw std::invalid_argument("Segment name too long: " + name);
+    }
+    
+    segment.partition();
+    
+    // The workers' page faults are counted in their own processes
+    if (MemoryTracker::isEnabled()) {
+        MemoryTracker::recordExternalWork();
+    }
+    
+    // Publish the job: everything above must be visible before the counter moves
+    std::memcpy(control_->segmentName, name.c_str(), name.size() + 1);
+    control_->failedWorkers.store(0, std::memory_order_relaxed);
+    control_->remaining.store(workers, std::memory_order_relaxed);
+    control_->jobSequence.fetch_add(1, std::memory_order_release);
+    futexWake(control_->jobSequence, INT_MAX);
+    
+    // Sleep on the futex until every worker is done, or one of them dies
+    // (workers only exit on shutdown, so any exit is a failure)
+    bool died = false;
+    timespec interval{ 0, WORKER_CHECK_INTERVAL_NS };
+    while (!died) {
+        uint32_t left = control_->remaining.load(std::memory_order_acquire);
+        if (left == 0) {
+            break;
+        }
+        futexWait(control_->remaining, left, &interval);
+        
+        for (int& pid : workerPids_) {
+            int status = 0;
+            if (pid > 0 && waitpid(pid, &status, WNOHANG) == pid) {
+                pid = 0;
+                died = true;
+            }
+        }
+    }
+    
+    if (died) {
+        stop(true);
+        throw std::runtime_error("Merge worker process failed");
+    }
+    if (control_->failedWorkers.load(std::memory_order_relaxed) != 0) {
+        throw std::runtime_error("Merge worker could not map segment " + name);
+    }
+#else
+    (void)segment;
+#endif
+}
+
+SharedMemoryMergeStrategy::SharedMemoryMergeStrategy(int K)
+    : numWorkers_(K > 0 ? K : 1),
+      pool_(std::make_unique<MergeWorkerPool>(numWorkers_)) {}
+
+std::vector<int> SharedMemoryMergeStrategy::merge(const std::vector<int>& vec1,
+                                                   const std::vector<int>& vec2) {
+    // Keep the segment (and the workers' mappings of it) while the sizes stay the same
+    if (!segment_ || segment_->size1() != vec1.size() || segment_->size2() != vec2.size()) {
+        segment_.reset();
+        segment_ = std::make_unique<SharedMergeSegment>(vec1.size(), vec2.size(), numWorkers_);
+    }
+    std::copy(vec1.begin(), vec1.end(), segment_->input1());
+    std::copy(vec2.begin(), vec2.end(), segment_->input2());
+    
+    pool_->run(*segment_);
+    
+    const int* output = segment_->output();
+    return std::vector<int>(output, output + vec1.size() + vec2.size());
+}
+
+void SharedMemoryMergeStrategy::mergeSegment(SharedMergeSegment& segment) {
+    pool_->run(segment);
+}
+
+std::string SharedMemoryMergeStrategy::getName() const {
+    return "Shared-memory processes (K=" + std::to_string(numWorkers_) + ")";
+}
+
+int SharedMemoryMergeStrategy::getWorkerCount() const {
+    return numWorkers_;
+}
+
+bool SharedMemoryMergeStrategy::isSupported() {
+#if defined(MERGE_HAS_SHARED_MEMORY_WORKERS)
+    return true;
+#else
+    return false;
+#endif
+}
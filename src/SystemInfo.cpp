@@ -3,10 +3,55 @@
 
 #include "../include/SystemInfo.h"
 #include <thread>
+#include <vector>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#elif defined(__linux__)
+#include <unistd.h>
+#endif
 
 namespace {
 	// Fallback if we can't detect hardware threads
 	constexpr unsigned int DEFAULT_THREAD_COUNT = 4;
+	
+	// Fallbacks if we can't detect cache sizes
+	constexpr size_t DEFAULT_L2_CACHE_SIZE = 256 * 1024;
+	constexpr size_t DEFAULT_L3_CACHE_SIZE = 8 * 1024 * 1024;
+	
+	// Ask the OS for the size of one cache level (0 if unknown)
+	size_t queryCacheSize(int level) {
+#if defined(_WIN32)
+		DWORD bufferSize = 0;
+		GetLogicalProcessorInformation(nullptr, &bufferSize);
+		if (bufferSize == 0) {
+			return 0;
+		}
+		
+		std::vector<SYSTEM_LOGICAL_PROCESSOR_INFORMATION> info(
+			bufferSize / sizeof(SYSTEM_LOGICAL_PROCESSOR_INFORMATION));
+		if (!GetLogicalProcessorInformation(info.data(), &bufferSize)) {
+			return 0;
+		}
+		
+		for (const auto& entry : info) {
+			if (entry.Relationship == RelationCache && entry.Cache.Level == level &&
+				(entry.Cache.Type == CacheUnified || entry.Cache.Type == CacheData)) {
+				return entry.Cache.Size;
+			}
+		}
+		return 0;
+#elif defined(__linux__) && defined(_SC_LEVEL2_CACHE_SIZE)
+		long size = sysconf(level == 2 ? _SC_LEVEL2_CACHE_SIZE : _SC_LEVEL3_CACHE_SIZE);
+		return size > 0 ? static_cast<size_t>(size) : 0;
+#else
+		(void)level;
+		return 0;
+#endif
+	}
 }
 
 unsigned int SystemInfo::getHardwareThreads() {
@@ -14,3 +59,17 @@ unsigned int SystemInfo::getHardwareThreads() {
     // Return default if detection fails
     return threads > 0 ? threads : DEFAULT_THREAD_COUNT;
 }
+
+size_t SystemInfo::getL2CacheSize() {
+    static const size_t cached = queryCacheSize(2);
+    return cached > 0 ? cached : DEFAULT_L2_CACHE_SIZE;
+}
+
+size_t SystemInfo::getLastLevelCacheSize() {
+    static const size_t cached = queryCacheSize(3);
+    if (cached > 0) {
+        return cached;
+    }
+    // Some CPUs have no L3, then L2 is the last level
+    return queryCacheSize(2) > 0 ? getL2CacheSize() : DEFAULT_L3_CACHE_SIZE;
+}
@@ -0,0 +1,171 @@
+// TieredMergeIndex.cpp
+// Tiered sorted runs with background compaction
+
+#include "../include/TieredMergeIndex.h"
+#include <algorithm>
+
+TieredMergeIndex::TieredMergeIndex(std::unique_ptr<IMergeStrategy> compactionStrategy,
+                                   size_t fanout, size_t maxLevel0Runs)
+    : strategy_(std::move(compactionStrategy)),
+      fanout_(std::max<size_t>(fanout, 2)),
+      maxLevel0Runs_(std::max(maxLevel0Runs, fanout_)),
+      levels_(1) {
+    // Start the thread last, after all members are ready
+    worker_ = std::thread(&TieredMergeIndex::compactionLoop, this);
+}
+
+TieredMergeIndex::~TieredMergeIndex() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    workAvailable_.notify_all();
+    worker_.join();
+}
+
+void TieredMergeIndex::append(std::vector<int> sortedBatch) {
+    if (sortedBatch.empty()) {
+        return;
+    }
+    auto run = std::make_shared<const Run>(std::move(sortedBatch));
+    
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        // Back-pressure: don't let lookups degrade without limit
+        stateChanged_.wait(lock, [this] { return levels_[0].size() < maxLevel0Runs_; });
+        
+        levels_[0].push_back(run);
+        totalSize_ += run->size();
+    }
+    workAvailable_.notify_one();
+}
+
+bool TieredMergeIndex::contains(int key) const {
+    for (const auto& run : snapshot()) {
+        if (std::binary_search(run->begin(), run->end(), key)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+size_t TieredMergeIndex::count(int key) const {
+    size_t total = 0;
+    for (const auto& run : snapshot()) {
+        auto range = std::equal_range(run->begin(), run->end(), key);
+        total += static_cast<size_t>(range.second - range.first);
+    }
+    return total;
+}
+
+std::vector<int> TieredMergeIndex::rangeScan(int low, int high) const {
+    std::vector<int> result;
+    if (high <= low) {
+        return result;
+    }
+    
+    // Append each run's slice and merge it with what we have so far
+    for (const auto& run : snapshot()) {
+        auto first = std::lower_bound(run->begin(), run->end(), low);
+        auto last = std::lower_bound(first, run->end(), high);
+        if (first == last) {
+            continue;
+        }
+        
+        size_t middle = result.size();
+        result.insert(result.end(), first, last);
+        std::inplace_merge(result.begin(), result.begin() + middle, result.end());
+    }
+    return result;
+}
+
+size_t TieredMergeIndex::size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return totalSize_;
+}
+
+size_t TieredMergeIndex::getRunCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_t runs = 0;
+    for (const auto& level : levels_) {
+        runs += level.size();
+    }
+    return runs;
+}
+
+size_t TieredMergeIndex::getCompactionCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return compactionCount_;
+}
+
+void TieredMergeIndex::waitForCompaction() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    stateChanged_.wait(lock, [this] { return !compacting_ && findLevelToCompact() < 0; });
+}
+
+std::vector<TieredMergeIndex::RunPtr> TieredMergeIndex::snapshot() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<RunPtr> runs;
+    for (const auto& level : levels_) {
+        runs.insert(runs.end(), level.begin(), level.end());
+    }
+    return runs;
+}
+
+int TieredMergeIndex::findLevelToCompact() const {
+    for (size_t level = 0; level < levels_.size(); ++level) {
+        if (levels_[level].size() >= fanout_) {
+            return static_cast<int>(level);
+        }
+    }
+    return -1;
+}
+
+void TieredMergeIndex::compactionLoop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    
+    while (true) {
+        workAvailable_.wait(lock, [this] { return stopping_ || findLevelToCompact() >= 0; });
+        if (stopping_) {
+            return;
+        }
+        
+        // Take every run of the level. They stay visible to readers until
+        // the merged run replaces them.
+        int level = findLevelToCompact();
+        std::vector<RunPtr> inputs = levels_[level];
+        compacting_ = true;
+        
+        lock.unlock();
+        RunPtr merged = mergeRuns(inputs);
+        lock.lock();
+        
+        // Only this thread removes runs, so the inputs are still the oldest
+        // runs of the level (appends only go to the back of level 0)
+        auto& source = levels_[level];
+        source.erase(source.begin(), source.begin() + inputs.size());
+        if (levels_.size() <= static_cast<size_t>(level) + 1) {
+            levels_.emplace_back();
+        }
+        levels_[level + 1].push_back(merged);
+        
+        ++compactionCount_;
+        compacting_ = false;
+        stateChanged_.notify_all();
+    }
+}
+
+TieredMergeIndex::RunPtr TieredMergeIndex::mergeRuns(std::vector<RunPtr> runs) {
+    // Merge neighbours pairwise until one run is left (log2(fanout) rounds)
+    while (runs.size() > 1) {
+        std::vector<RunPtr> next;
+        for (size_t i = 0; i + 1 < runs.size(); i += 2) {
+            next.push_back(std::make_shared<const Run>(strategy_->merge(*runs[i], *runs[i + 1])));
+        }
+        if (runs.size() % 2 == 1) {
+            next.push_back(runs.back());
+        }
+        runs = std::move(next);
+    }
+    return runs.front();
+}
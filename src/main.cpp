@@ -4,10 +4,34 @@
 
 #include "../include/SystemInfo.h"
 #include "../include/ExperimentRunner.h"
+#include "../include/PhaseTracer.h"
 #include <iostream>
+#include <string>
 #include <vector>
 
-int main() {
+namespace {
+    // Sizes for the scaling study (--scaling)
+    constexpr size_t STRONG_SCALING_SIZE = 10'000'000;
+    constexpr size_t WEAK_SCALING_SIZE_PER_THREAD = 1'000'000;
+    
+    // Incremental index benchmark (--incremental): 100 batches of 100K = 10M elements
+    constexpr size_t INCREMENTAL_BATCH_SIZE = 100'000;
+    constexpr int INCREMENTAL_BATCH_COUNT = 100;
+    
+    // Partial merge benchmark (--partial)
+    constexpr size_t PARTIAL_MERGE_SIZE = 10'000'000;
+    constexpr size_t PARTIAL_MERGE_PAGE_SIZE = 100;
+}
+
+int main(int argc, char* argv[]) {
+    // Usage: merge_benchmark                - run experiments 1-3
+    //        merge_benchmark --cache-blocked - run only the cache-blocked kernel benchmark (needs > 6 GB RAM)
+    //        merge_benchmark --scaling      - run only the scaling study
+    //        merge_benchmark --incremental  - run only the incremental index benchmark
+    //        merge_benchmark --partial      - run only the partial merge (pages, k-th element) benchmark
+    //        merge_benchmark --processes    - run only the worker processes vs. threads benchmark
+    std::string mode = (argc > 1) ? argv[1] : "";
+    
     std::cout << "=============================================================================\n";
     std::cout << "         MERGE ALGORITHM PERFORMANCE ANALYSIS\n";
     std::cout << "=============================================================================\n";
@@ -25,17 +49,47 @@ int main() {
         10'000'000    // 10 million
     };
     
-    std::cout << "\nTest Data Sizes:\n";
-    for (size_t size : testSizes) {
-        std::cout << "  " << size << " elements\n";
-    }
+    // Production-sized merges for the cache-blocked kernel (mostly bigger than any cache)
+    std::vector<size_t> largeTestSizes = {
+        10'000'000,   // 10 million
+        100'000'000,  // 100 million
+        500'000'000   // 500 million
+    };
     
-    // Run all experiments
     ExperimentRunner runner(testSizes);
     
-    runner.runExperiment1_SequentialMerge();
-    runner.runExperiment2_PolicyMerge();
-    runner.runExperiment3_KInvestigation(testSizes.back());
+    if (mode == "--cache-blocked") {
+        runner.runExperiment4_CacheBlockedMerge(largeTestSizes);
+    } else if (mode == "--scaling") {
+        runner.runExperiment5_ScalingStudy(STRONG_SCALING_SIZE, WEAK_SCALING_SIZE_PER_THREAD);
+    } else if (mode == "--incremental") {
+        runner.runExperiment6_IncrementalIndex(INCREMENTAL_BATCH_SIZE, INCREMENTAL_BATCH_COUNT);
+    } else if (mode == "--partial") {
+        runner.runExperiment7_PartialMerge(PARTIAL_MERGE_SIZE, PARTIAL_MERGE_PAGE_SIZE);
+    } else if (mode == "--processes") {
+        runner.runExperiment8_ProcessIsolation();
+    } else {
+        std::cout << "\nTest Data Sizes:\n";
+        for (size_t size : testSizes) {
+            std::cout << "  " << size << " elements\n";
+        }
+        
+        // Run all experiments
+        runner.runExperiment1_SequentialMerge();
+        runner.runExperiment2_PolicyMerge();
+        runner.runExperiment3_KInvestigation(testSizes.back());
+    }
+    
+#ifdef MERGE_TRACING
+    // Open in chrome://tracing or https://ui.perfetto.dev
+    const std::string tracePath = "merge_trace.json";
+    if (PhaseTracer::instance().exportChromeTrace(tracePath)) {
+        std::cout << "\nPhase trace written to " << tracePath << " ("
+                  << PhaseTracer::instance().getDroppedCount() << " events dropped)\n";
+    } else {
+        std::cout << "\nCould not write phase trace to " << tracePath << "\n";
+    }
+#endif
     
     std::cout << "\n=============================================================================\n";
     std::cout << "Analysis completed successfully.\n";